@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_ADAMS_VSVO_H
+#define ASTRO_ADAMS_VSVO_H
+
+#include <array>
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <mth_ode.h>
+
+#include <mth_ode_solver.h>
+
+namespace eom {
+
+/**
+ * Propagates astrodynamics equations of motion using a variable step
+ * size, variable order (1 through 12) Adams-Bashforth-Moulton PECE
+ * integrator with local error control.  Self starting - integration
+ * begins at first order with small steps, raising the order and step
+ * size as the differences accumulate.  Predictor and corrector
+ * derivative evaluations are flagged via OdeEvalMethod so force models
+ * may reuse expensive terms during the corrector evaluation.
+ *
+ * Steps are limited to a maximum size so that ephemeris interpolated
+ * between integration nodes remains accurate.
+ *
+ * Algorithm from L. F. Shampine and M. K. Gordon, "Computer Solution
+ * of Ordinary Differential Equations:  The Initial Value Problem",
+ * 1975 (STEP routine).
+ */
+class AdamsVsvo : public OdeSolver<JulianDate, double, 6> {
+public:
+  ~AdamsVsvo() = default;
+  AdamsVsvo(const AdamsVsvo&) = delete;
+  AdamsVsvo& operator=(const AdamsVsvo&) = delete;
+  AdamsVsvo(AdamsVsvo&&) = default;
+  AdamsVsvo& operator=(AdamsVsvo&&) = default;
+
+  /**
+   * Initialize with equations of motion, maximum step size, error
+   * tolerances, and initial state of the system to be integrated.
+   *
+   * @param  deq      Equations of motion
+   * @param  dt       Maximum integration step size.  The sign sets the
+   *                  direction of integration.
+   * @param  jd       State vector epoch
+   * @param  x        Initial conditions - state vector at epoch
+   * @param  rel_tol  Relative local error tolerance
+   * @param  abs_tol  Absolute local error tolerance, DU and DU/TU
+   *
+   * @throws  invalid_argument if tolerances are not positive
+   */
+  AdamsVsvo(std::unique_ptr<Ode<JulianDate, double, 6>> deq,
+            const Duration& dt,
+            const JulianDate& jd,
+            const Eigen::Matrix<double, 6, 1>& x,
+            double rel_tol,
+            double abs_tol);
+
+  /**
+   * @return  Time associated with current state vector and derivative, UTC
+   */
+  JulianDate getT() const noexcept override;
+
+  /**
+   * @return  Current state vector, DU
+   */
+  Eigen::Matrix<double, 6, 1> getX() const noexcept override;
+
+  /**
+   * @return  Time derivative of current state vector, DU, DU/TU
+   */
+  Eigen::Matrix<double, 6, 1> getXdot() const noexcept override;
+
+  /**
+   * Propagate by the largest step, up to the maximum step size, that
+   * satisfies the error tolerances, adjusting the order for the next.
+   *
+   * @return   Time associated with propagated state.
+   *
+   * @throws  runtime_error if the step size or error tolerance becomes
+   *          too small relative to machine precision
+   */
+  JulianDate step() override;
+
+private:
+  std::unique_ptr<Ode<JulianDate, double, 6>> m_deq {nullptr};
+  double m_dt_max {0.0};
+  JulianDate m_jd0;
+  JulianDate m_jd;
+    // Error tolerance and relative/absolute error weight contributions
+  double m_eps {0.0};
+  double m_releps {0.0};
+  double m_abseps {0.0};
+    // Integrator state, time in TU relative to epoch.  Arrays use the
+    // 1 based indexing of the published algorithm.
+  double m_t {0.0};
+  Eigen::Matrix<double, 6, 1> m_y;
+  Eigen::Matrix<double, 6, 1> m_yp;
+  double m_h {0.0};
+  double m_hold {0.0};
+  int m_k {0};
+  int m_kold {0};
+  int m_ns {0};
+  bool m_start {true};
+  bool m_phase1 {true};
+  bool m_nornd {true};
+  std::array<Eigen::Matrix<double, 6, 1>, 17> m_phi;
+  std::array<double, 14> m_psi {};
+  std::array<double, 14> m_alpha {};
+  std::array<double, 14> m_beta {};
+  std::array<double, 14> m_sig {};
+  std::array<double, 14> m_v {};
+  std::array<double, 14> m_w {};
+  std::array<double, 14> m_g {};
+};
+
+
+}
+
+#endif
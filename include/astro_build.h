@@ -14,9 +14,15 @@
 #include <unordered_map>
 #include <vector>
 
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_dispersion_def.h>
+#include <astro_dispersion_stats.h>
 #include <astro_ecfeci_sys.h>
 #include <astro_ephemeris.h>
 #include <astro_ephemeris_file.h>
+#include <astro_ephemeris_variant.h>
 #include <astro_orbit_def.h>
 #include <astro_rel_orbit_def.h>
 
@@ -50,6 +56,64 @@ build_orbit(const OrbitDef& orbitParams,
             const std::unordered_map<std::string,
                                      std::vector<eom::state_vector_rec>>& ceph);
 
+/**
+ * Creates ephemeris "services" for a set of orbit definitions,
+ * concurrently.  Orbit definitions with ensemble propagation enabled
+ * that share an epoch and a compatible propagator configuration are
+ * propagated in lockstep as ensembles of up to 16 members.  All others
+ * are built individually via build_orbit().
+ *
+ * @param  orbitDefs  Orbit definitions
+ * @param  ecfeciSys  Ecf/Eci utility service pointer that will be
+ *                    copied into the Ephemeris objects.
+ * @param  ceph       Celestial ephemerides
+ *
+ * @throws  std::invalid_argument  With observed inconsistency that
+ *                                 escaped error checking during
+ *                                 parsing.
+ *
+ * @return  Orbit implementations, in the order of orbitDefs
+ */
+std::vector<std::unique_ptr<Ephemeris>>
+build_orbits(const std::vector<OrbitDef>& orbitDefs,
+             const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+             const std::unordered_map<std::string,
+                                      std::vector<eom::state_vector_rec>>& ceph);
+
+/**
+ * Monte Carlo dispersion of an orbit definition.  States are sampled
+ * about the template orbit initial state given the dispersion
+ * covariance and seed, each defining an orbit definition with the
+ * template propagator configuration.  These are built concurrently via
+ * build_orbits() in blocks, sampled, and accumulated into summary
+ * statistics before being released, so only one block of ephemerides
+ * is resident at a time.  Sampled states depend only on the seed, not
+ * the block size.
+ *
+ * @param  dispDef        Dispersion definition
+ * @param  templateOrbit  Orbit definition to disperse
+ * @param  start          Time of the first statistics point, UTC
+ * @param  dt             Time between statistics points
+ * @param  points         Number of statistics points
+ * @param  ecfeciSys      Ecf/Eci utility service pointer shared by all
+ *                        sampled orbits
+ * @param  ceph           Celestial ephemerides
+ *
+ * @return  Mean and covariance of GCRF state vectors at each point
+ *
+ * @throws  std::invalid_argument  If the template orbit is not defined
+ *                                 by a state vector (e.g., a TLE).
+ */
+DispersionStats
+build_dispersion(const DispersionDef& dispDef,
+                 const OrbitDef& templateOrbit,
+                 const JulianDate& start,
+                 const Duration& dt,
+                 unsigned long points,
+                 const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+                 const std::unordered_map<
+                     std::string, std::vector<eom::state_vector_rec>>& ceph);
+
 /**
  * Creates an ephemeris "service" based on a reference orbit and a
  * relative orbit definition.
@@ -89,6 +153,19 @@ build_ephemeris(const EphemerisFile& efd,
                 const JulianDate& stopTime,
                 const std::shared_ptr<const EcfEciSys>& ecfeciSys);
 
+/**
+ * Resolve an ephemeris resource to its concrete type, when listed by
+ * EphemerisVariant, for use by consumers instantiated per ephemeris
+ * type.  The type erased resource is shared, not copied.
+ *
+ * @param  eph  Ephemeris resource
+ *
+ * @return  Variant holding eph as its concrete type, or as an Ephemeris
+ *          if not listed by EphemerisVariant.
+ */
+EphemerisVariant resolve_ephemeris(const std::shared_ptr<const Ephemeris>& eph);
+
+
 /**
  * Create a set of ephemeris records for celestial objects given
  * an .emb (eom binary/unformatted) ephemeris file.
@@ -101,8 +178,8 @@ build_ephemeris(const EphemerisFile& efd,
  *                      be present in file.
  * @param  stopTime     Latest time for which ephemeris needs to be
  *                      present in file.
- * @param  ecfeciSys    Ecf/Eci utility service pointer that will be
- *                      copied into the Ephemeris object.
+ * @param  leapSeconds  TAI - UTC table used to convert ephemeris
+ *                      times from TT to UTC
  *
  * @return  State vector records
  *
@@ -112,7 +189,8 @@ build_ephemeris(const EphemerisFile& efd,
 std::vector<state_vector_rec>
 build_celestial(const std::string& name_prefix,
                 const JulianDate& startTime,
-                const JulianDate& stopTime);
+                const JulianDate& stopTime,
+                const LeapSeconds& leapSeconds);
 
 /**
  * Parse NGS SP3-c compatible ephemeris.  'V' format ECF position and
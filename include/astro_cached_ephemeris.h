@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_CACHED_EPHEMERIS_H
+#define ASTRO_CACHED_EPHEMERIS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <astro_ephemeris.h>
+
+namespace eom {
+
+/**
+ * Memoizing wrapper around any Ephemeris.  Results are stored in a
+ * direct mapped cache keyed by time and reference frame so consumers
+ * repeatedly requesting identical times, such as multiple access
+ * analyses and output commands sampling the same orbit on a common
+ * grid, evaluate the underlying ephemeris once.  A new result replaces
+ * whatever occupied its slot.
+ *
+ * The cache is lock free.  Each slot is guarded by a sequence counter -
+ * readers treat a slot being written, or modified while read, as a
+ * miss, and writers skip storing a result when another thread holds the
+ * slot.  A single instance may be shared by any number of threads.
+ *
+ * Cached values are those returned by whichever query first computed
+ * them, so results may differ from the wrapped ephemeris by rounding
+ * where its query methods do (e.g., sample() vs. getStateVector()).
+ * Batch queries, getStateVectors() and sample(), are forwarded in full
+ * when no time is found in the cache.  Otherwise, only the times not
+ * found are evaluated.
+ *
+ * Hit and miss counts, one per requested time, are kept to judge
+ * whether caching benefits a given workload.
+ */
+class CachedEphemeris : public Ephemeris {
+public:
+  ~CachedEphemeris() = default;
+  CachedEphemeris(const CachedEphemeris&) = delete;
+  CachedEphemeris& operator=(const CachedEphemeris&) = delete;
+  CachedEphemeris(CachedEphemeris&&) = delete;
+  CachedEphemeris& operator=(CachedEphemeris&&) = delete;
+
+  /**
+   * @param  eph    Ephemeris to wrap
+   * @param  slots  Number of cache entries, rounded up to a power of 2
+   *
+   * @throws  invalid_argument if eph is null or slots is zero
+   */
+  explicit CachedEphemeris(std::shared_ptr<Ephemeris> eph,
+                           unsigned long slots = 4096UL);
+
+  /**
+   * @return  The wrapped ephemeris
+   */
+  std::shared_ptr<Ephemeris> getEphemeris() const noexcept
+  {
+    return m_eph;
+  }
+
+  /**
+   * @return  Number of cache entries
+   */
+  unsigned long getSlots() const noexcept
+  {
+    return m_mask + 1UL;
+  }
+
+  /**
+   * @return  Number of requested times returned from the cache
+   */
+  unsigned long getHits() const noexcept
+  {
+    return m_hits.count.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return  Number of requested times evaluated by the wrapped
+   *          ephemeris
+   */
+  unsigned long getMisses() const noexcept
+  {
+    return m_misses.count.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return  Fraction of requested times returned from the cache, zero
+   *          if no requests have been made
+   */
+  double getHitRate() const noexcept;
+
+  /**
+   * @return  Unique ephemeris identifier, that of the wrapped ephemeris
+   */
+  std::string getName() const override
+  {
+    return m_eph->getName();
+  }
+
+  /**
+   * @return  Wrapped ephemeris epoch
+   */
+  JulianDate getEpoch() const override
+  {
+    return m_eph->getEpoch();
+  }
+
+  /**
+   * @return  Earliest time for which ephemeris can be retrieved
+   */
+  JulianDate getBeginTime() const override
+  {
+    return m_eph->getBeginTime();
+  }
+
+  /**
+   * @return  Latest time for which ephemeris can be retrieved
+   */
+  JulianDate getEndTime() const override
+  {
+    return m_eph->getEndTime();
+  }
+
+  /**
+   * See Ephemeris::getStateVector()
+   */
+  Eigen::Matrix<double, 6, 1> getStateVector(const JulianDate& jd,
+                                             EphemFrame frame) const override;
+
+  /**
+   * See Ephemeris::getPosition().  Satisfied by any cached result at
+   * the same time and frame.  Positions evaluated on a miss are cached
+   * without velocity.
+   */
+  Eigen::Matrix<double, 3, 1> getPosition(const JulianDate& jd,
+                                          EphemFrame frame) const override;
+
+  /**
+   * See Ephemeris::getStateVectors()
+   */
+  void getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+  /**
+   * See Ephemeris::sample()
+   */
+  void sample(const JulianDate& start, const Duration& dt,
+              unsigned long n, EphemFrame frame,
+              Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+private:
+    // Slot contents are atomics so concurrent reads and writes are
+    // well defined - the sequence counter is odd while being written
+  struct alignas(64) slot {
+    std::atomic<std::uint32_t> seq {0U};
+    std::atomic<std::uint32_t> tag {0U};
+    std::atomic<double> jd_hi {0.0};
+    std::atomic<double> jd_lo {0.0};
+    std::array<std::atomic<double>, 6> x {};
+  };
+
+    // Counters on separate cache lines
+  struct alignas(64) counter {
+    std::atomic<unsigned long> count {0UL};
+  };
+
+  static std::uint32_t tag(EphemFrame frame, bool vel) noexcept;
+  slot& locate(const JulianDate& jd, EphemFrame frame) const noexcept;
+    // Copy the first nx elements of a matching entry
+  bool lookup(const JulianDate& jd, EphemFrame frame, bool vel,
+              double* x, int nx) const noexcept;
+  void store(const JulianDate& jd, EphemFrame frame, bool vel,
+             const double* x, int nx) const noexcept;
+  void count(unsigned long hits, unsigned long misses) const noexcept;
+
+  std::shared_ptr<Ephemeris> m_eph {nullptr};
+  unsigned long m_mask {0UL};
+  std::unique_ptr<slot[]> m_slots {nullptr};
+  mutable counter m_hits;
+  mutable counter m_misses;
+};
+
+
+}
+
+#endif
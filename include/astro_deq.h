@@ -17,6 +17,7 @@
 #include <mth_ode.h>
 #include <cal_julian_date.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_cursor.h>
 #include <astro_gravity.h>
 #include <astro_force_model.h>
 
@@ -68,6 +69,7 @@ public:
 
 private:
   std::shared_ptr<const EcfEciSys> m_ecfeci {nullptr};
+  EcfEciCursor m_f2i_cursor;
   std::unique_ptr<Gravity> m_grav {nullptr};
 
   std::vector<std::unique_ptr<ForceModel>> m_fmodels;
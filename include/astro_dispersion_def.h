@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_DISPERSION_DEF_H
+#define ASTRO_DISPERSION_DEF_H
+
+#include <string>
+
+#include <Eigen/Dense>
+
+namespace eom {
+
+
+/**
+ * Holds parameters defining a Monte Carlo dispersion of an orbit
+ * definition:  the template orbit, the number of states to sample
+ * about the template orbit initial state, the seed for the random
+ * number generator, and the covariance from which the samples are
+ * drawn.  The covariance is of the Cartesian GCRF state at the template
+ * orbit epoch.
+ */
+class DispersionDef {
+public:
+  /**
+   * Create a dispersion definition
+   *
+   * @param  name           Name (string identifier) of the dispersion
+   * @param  template_name  Name of orbit definition to disperse
+   * @param  samples        Number of sampled states
+   * @param  seed           Random number generator seed
+   * @param  covariance     Covariance of Cartesian GCRF position and
+   *                        velocity at the template orbit epoch, DU^2,
+   *                        DU^2/TU, DU^2/TU^2
+   * @param  file_name      Name of file to which statistics are written
+   *
+   * @throws  invalid_argument if fewer than two samples are requested
+   *          or the covariance is not symmetric positive semidefinite.
+   */
+  DispersionDef(const std::string& name,
+                const std::string& template_name,
+                unsigned long samples,
+                unsigned long seed,
+                const Eigen::Matrix<double, 6, 6>& covariance,
+                const std::string& file_name);
+
+  /**
+   * @return  Name (string identifier) of the dispersion
+   */
+  std::string getName() const noexcept { return m_name; }
+
+  /**
+   * @return  Name of orbit definition to disperse
+   */
+  std::string getTemplateOrbitName() const noexcept { return m_ref_name; }
+
+  /**
+   * @return  Number of sampled states
+   */
+  unsigned long getSamples() const noexcept { return m_samples; }
+
+  /**
+   * @return  Random number generator seed
+   */
+  unsigned long getSeed() const noexcept { return m_seed; }
+
+  /**
+   * @return  Covariance of Cartesian GCRF position and velocity at the
+   *          template orbit epoch, DU and TU based
+   */
+  Eigen::Matrix<double, 6, 6> getCovariance() const { return m_cov; }
+
+  /**
+   * @return  Name of file to which statistics are written
+   */
+  std::string getFileName() const noexcept { return m_file_name; }
+
+private:
+  std::string m_name {""};
+  std::string m_ref_name {""};
+  unsigned long m_samples {};
+  unsigned long m_seed {};
+  Eigen::Matrix<double, 6, 6> m_cov;
+  std::string m_file_name {""};
+};
+
+
+}
+
+#endif
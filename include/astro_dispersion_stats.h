@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_DISPERSION_STATS_H
+#define ASTRO_DISPERSION_STATS_H
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+
+namespace eom {
+
+
+/**
+ * Running mean and covariance of sampled state vectors on a uniform
+ * time grid.  Samples are accumulated one trajectory at a time using
+ * Welford's method so only the statistics, not the trajectories, are
+ * retained.  Results depend on the order in which trajectories are
+ * accumulated only to the extent of floating point rounding.
+ */
+class DispersionStats {
+public:
+  /**
+   * Initialize with no accumulated samples.
+   *
+   * @param  name    Name (string identifier) of the dispersion
+   * @param  start   Time of the first point, UTC
+   * @param  dt      Time between points
+   * @param  points  Number of points in time
+   */
+  DispersionStats(const std::string& name,
+                  const JulianDate& start,
+                  const Duration& dt,
+                  unsigned long points);
+
+  /**
+   * Accumulate a sampled trajectory.
+   *
+   * @param  xvec  Cartesian state vectors, one column per point in
+   *               time, DU and DU/TU.  Additional columns are ignored.
+   *
+   * @throws  invalid_argument if xvec has fewer columns than points
+   *          in time.
+   */
+  void accumulate(
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xvec);
+
+  /**
+   * @return  Name (string identifier) of the dispersion
+   */
+  std::string getName() const noexcept { return m_name; }
+
+  /**
+   * @return  Number of accumulated trajectories
+   */
+  unsigned long getSamples() const noexcept { return m_samples; }
+
+  /**
+   * @return  Number of points in time
+   */
+  unsigned long getPoints() const noexcept { return m_m2.size(); }
+
+  /**
+   * @param  ndx  Index of point in time, [0, getPoints())
+   *
+   * @return  Time of the point, UTC
+   */
+  JulianDate getTime(unsigned long ndx) const;
+
+  /**
+   * @param  ndx  Index of point in time, [0, getPoints())
+   *
+   * @return  Mean state vector, DU and DU/TU
+   */
+  Eigen::Matrix<double, 6, 1> getMean(unsigned long ndx) const;
+
+  /**
+   * @param  ndx  Index of point in time, [0, getPoints())
+   *
+   * @return  Sample covariance of the state vector, DU and TU based.
+   *          Zero until at least two trajectories are accumulated.
+   */
+  Eigen::Matrix<double, 6, 6> getCovariance(unsigned long ndx) const;
+
+private:
+  std::string m_name {""};
+  JulianDate m_start;
+  Duration m_dt;
+  unsigned long m_samples {0UL};
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_mean;
+    // Sum of squared differences from the mean
+  std::vector<Eigen::Matrix<double, 6, 6>> m_m2;
+};
+
+
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_ECFECI_CURSOR_H
+#define ASTRO_ECFECI_CURSOR_H
+
+#include <memory>
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+#include <cal_julian_date.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_transform.h>
+
+namespace eom {
+
+/**
+ * Stateful accessor of EcfEciSys data optimized for sequences of
+ * requests moving monotonically through time, as with numerical
+ * integration, ephemeris generation, and access searches.  The pair of
+ * nodes bracketing the most recent request and the quaternion
+ * interpolation parameters between them are retained so subsequent
+ * requests within the same or following interval require no index
+ * search or node setup.  Requests elsewhere fall back to a direct
+ * lookup, so any sequence of times is supported.  The earth rotation
+ * angle is likewise advanced from the previous request rather than
+ * reevaluated, with its sine and cosine updated via a short series.
+ *
+ * A cursor is not thread safe - each thread should hold its own.  Any
+ * number of cursors may share the same EcfEciSys.
+ */
+class EcfEciCursor {
+public:
+  ~EcfEciCursor() = default;
+  EcfEciCursor(const EcfEciCursor&) = default;
+  EcfEciCursor& operator=(const EcfEciCursor&) = default;
+  EcfEciCursor(EcfEciCursor&&) = default;
+  EcfEciCursor& operator=(EcfEciCursor&&) = default;
+
+  /**
+   * Initialize with the ECF/ECI service to traverse.
+   *
+   * @param  ecfeci  ECF/ECI conversion resource
+   */
+  explicit EcfEciCursor(std::shared_ptr<const EcfEciSys> ecfeci);
+
+  /**
+   * Retrieve ECF/ECI data, interpolated as configured by the
+   * EcfEciSys, advancing the cursor to the requested time.  Identical
+   * to EcfEciSys::getEcfEciData() other than rounding.
+   *
+   * @param  utc  UTC time for which ECF/ECI data is needed
+   *
+   * @return  ECF/ECI data
+   *
+   * @throws  out_of_range if the requested time is out of range
+   */
+  ecf_eci getEcfEciData(const JulianDate& utc);
+
+  /**
+   * Retrieve the ECF/ECI transformation for the requested time,
+   * advancing the cursor.  See EcfEciSys::getTransform().  Identical
+   * other than rounding.
+   *
+   * @param  utc  UTC time for which the transformation is needed
+   *
+   * @return  ECF/ECI transformation valid at utc
+   *
+   * @throws  out_of_range if the requested time is out of range
+   */
+  EcfEciTransform getTransform(const JulianDate& utc);
+
+private:
+    // Quaternion spherical linear interpolation with the angle between
+    // endpoints precomputed - see Eigen::Quaterniond::slerp()
+  struct qslerp {
+    void set(const Eigen::Quaterniond& q1, const Eigen::Quaterniond& q2);
+    Eigen::Quaterniond at(double t) const;
+
+    Eigen::Quaterniond qa;
+    Eigen::Quaterniond qb;
+    double theta {0.0};
+    double inv_sin {0.0};
+    bool linear {true};
+    bool flip {false};
+  };
+
+    // Position the cursor on the interval containing mjd2000
+  void seek(const JulianDate& utc, double mjd2000);
+
+  std::shared_ptr<const EcfEciSys> m_ecfeci {nullptr};
+  bool m_valid {false};
+  unsigned long m_ndx {0UL};
+  double m_mjd1 {0.0};
+  double m_per_rate {0.0};
+  double m_ut1mutc {0.0};
+  double m_dut1mutc {0.0};
+  double m_lod {0.0};
+  double m_dlod {0.0};
+  qslerp m_bpn;
+  qslerp m_pm;
+  EcfEciSys::era_phase m_era;
+};
+
+
+}
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_ECFECI_REGISTRY_H
+#define ASTRO_ECFECI_REGISTRY_H
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_ecfeci_sys.h>
+
+namespace eom {
+
+/**
+ * Thread safe source of shared, read only, ECF/ECI services for
+ * processes running multiple scenarios.  Requests with the same rate,
+ * options, and leap seconds that fall within the span of an existing
+ * ECF/ECI service are given that service.  Otherwise, a new service is
+ * generated covering the union of the requested span and any
+ * overlapping existing spans still in use, replacing them in the
+ * registry.  Services held only by the registry are released once they
+ * no longer satisfy incoming requests, and don't widen new services.  Services are generated outside of the registry
+ * lock so requests for unrelated spans aren't blocked while another is
+ * being generated.  Requests covered by a service still being generated
+ * wait for it rather than generating a duplicate.
+ */
+class EcfEciRegistry {
+public:
+  ~EcfEciRegistry() = default;
+  EcfEciRegistry(const EcfEciRegistry&) = delete;
+  EcfEciRegistry& operator=(const EcfEciRegistry&) = delete;
+  EcfEciRegistry(EcfEciRegistry&&) = delete;
+  EcfEciRegistry& operator=(EcfEciRegistry&&) = delete;
+
+  /**
+   * Initialize with the source of EOP data used by all generated
+   * ECF/ECI services.
+   *
+   * @param  eop_file  IERS EOP file, see EopSys.  If empty, all EOP
+   *                   values are set to zero.
+   */
+  EcfEciRegistry(const std::string& eop_file = "");
+
+  /**
+   * Locate or generate an ECF/ECI service valid over the requested
+   * time span.  See EcfEciSys for a description of parameters.
+   *
+   * @param  startTime    Earliest UTC time for which ECF to ECI data is
+   *                      to be available.
+   * @param  stopTime     Latest UTC time for which ECF to ECI data is
+   *                      to be available.
+   * @param  dt           Rate at which to generate ECF to ECI data
+   * @param  leapSeconds  TAI - UTC table.  Services are shared only
+   *                      between requests with identical tables.
+   * @param  lazy         If true, generate ECF to ECI data as needed
+   * @param  chebyshev    If true, Chebyshev interpolation of ECF to ECI
+   *                      parameters
+   * @param  cache_dir    If not empty, directory of binary ECF to ECI
+   *                      data files
+   *
+   * @return  ECF/ECI service covering at least the requested time span
+   *
+   * @throws  runtime_error if EOP data can't be loaded.  Requests
+   *          waiting on the failed service receive the same exception.
+   */
+  std::shared_ptr<const EcfEciSys>
+  getEcfEciSys(const JulianDate& startTime,
+               const JulianDate& stopTime,
+               const Duration& dt,
+               std::shared_ptr<const LeapSeconds> leapSeconds,
+               bool lazy = false,
+               bool chebyshev = false,
+               const std::string& cache_dir = "");
+
+  /**
+   * @return  Number of ECF/ECI services currently held by the registry
+   */
+  unsigned long size() const;
+
+private:
+  struct registry_entry {
+    JulianDate jdStart;
+    JulianDate jdStop;
+    double rate_days {0.0};
+    std::uint64_t leap_hash {0};
+    bool lazy {false};
+    bool chebyshev {false};
+    std::string cache_dir {""};
+      // Nonzero, unique to the generated service
+    std::uint64_t id {0};
+    std::shared_future<std::shared_ptr<const EcfEciSys>> f2iSys;
+  };
+
+  mutable std::mutex m_mutex;
+  std::uint64_t m_next_id {1};
+  std::string m_eop_file {""};
+  std::vector<registry_entry> m_entries;
+};
+
+
+}
+
+#endif
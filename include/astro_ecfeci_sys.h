@@ -11,12 +11,17 @@
 
 #include <cal_duration.h>
 #include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
 #include <astro_eop_sys.h>
+#include <astro_ecfeci_transform.h>
+#include <utl_mapped_file.h>
 
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace eom {
@@ -33,6 +38,19 @@ struct ecf_eci {
   Eigen::Quaterniond bpn;    ///< Frame bias, precession, nutation; CIRF to GCRF
 };
 
+/**
+ * Parameters from which the ecf_eci BPN and polar motion
+ * transformations are formed.
+ */
+struct cip_pm {
+  double x {0.0};            ///< CIP X coordinate with EOP correction, radians
+  double y {0.0};            ///< CIP Y coordinate with EOP correction, radians
+  double s {0.0};            ///< CIO locator, radians
+  double sp {0.0};           ///< TIO locator, radians
+  double xp {0.0};           ///< Polar motion x, radians
+  double yp {0.0};           ///< Polar motion y, radians
+};
+
 /**
  * Equinox based transformations
  */
@@ -48,6 +66,8 @@ struct meme_eci {
  * @date    20211020
  */
 class EcfEciSys {
+  friend class EcfEciCursor;
+
 public:
   /**
    * This constructor creates an ECF to ECI conversion utility that
@@ -67,14 +87,50 @@ public:
    *                      center of the timeframe.
    * @param  eopSys       EOP data source - if nullptr, then all eop
    *                      values are set to zero.
+   * @param  leapSeconds  TAI - UTC table used for UTC to TT conversions
    * @param  interpolate  If true, ECF to ECI data will be interpolated.
    *                      Defaults to true.
+   * @param  lazy         If true, ECF to ECI data is generated in fixed
+   *                      size blocks the first time a block is accessed
+   *                      vs. generating all data upon construction.
+   *                      Defaults to false.
+   * @param  chebyshev    If true, and interpolating, the CIP coordinates,
+   *                      CIO and TIO locators, and EOP values are
+   *                      interpolated rather than the BPN and polar
+   *                      motion quaternions.  Each lookup fits a cubic
+   *                      Chebyshev polynomial to the four nodes nearest
+   *                      the requested time, two on either side when
+   *                      available, so the fit slides with the
+   *                      requested time rather than being fixed per
+   *                      segment.  Allows for a larger dt for the same
+   *                      accuracy.  This trades lookup speed for node
+   *                      spacing - no coefficients are stored, and each
+   *                      lookup is slower than linear interpolation.
+   *                      The benefit is fewer nodes to generate and
+   *                      store.
+   *                      UT1 - TAI is fit across a leap second.
+   *                      Requires at least four nodes, otherwise linear
+   *                      interpolation is used.  Defaults to false.
+   * @param  cache_dir    If not empty, directory of binary ECF to ECI
+   *                      data files.  Data are loaded from the file
+   *                      matching the time span, rate, leap seconds, and
+   *                      EOP data, if present.  Otherwise, data are
+   *                      generated and written to a new file.  Failure
+   *                      to write the file is not an error.  With lazy
+   *                      set, data are decoded from the mapped file by
+   *                      block as accessed.  Writing a new file
+   *                      requires all data, so lazy is not honored when
+   *                      the file is not present - see isLazy().
    */
   EcfEciSys(const JulianDate& startTime,
             const JulianDate& stopTime,
             const Duration& dt,
             const std::shared_ptr<eom::EopSys>& eopSys,
-            bool interpolate = true);
+            std::shared_ptr<const LeapSeconds> leapSeconds,
+            bool interpolate = true,
+            bool lazy = false,
+            bool chebyshev = false,
+            const std::string& cache_dir = "");
 
   /**
    * @return  Earliest time for which transformations can be performed
@@ -92,6 +148,23 @@ public:
     return jdStop;
   }
 
+  /**
+   * @return  true if ECF to ECI data is populated by block as accessed
+   *          rather than upon construction
+   */
+  bool isLazy() const noexcept
+  {
+    return lazy_load;
+  }
+
+  /**
+   * @return  TAI - UTC table used by this ECF/ECI service
+   */
+  const LeapSeconds& getLeapSeconds() const noexcept
+  {
+    return *m_leapSeconds;
+  }
+
   /**
    * Returns an ecf_eci struucture.  Primarily intended for internal use
    * but public given the potential usefulness.
@@ -105,6 +178,33 @@ public:
    */
   ecf_eci getEcfEciData(const JulianDate& utc) const;
 
+  /**
+   * Returns the full ECF/ECI transformation for the given time.  The
+   * ECF to ECI data lookup, interpolation, and earth rotation angle
+   * are evaluated once so the returned transformation can be applied
+   * to multiple vectors valid at the same time.
+   *
+   * @param  utc  Time for which to generate the transformation
+   *
+   * @return  ECF/ECI transformation valid at the input time
+   *
+   * @throws  out_of_range if the requested time is out of range
+   */
+  EcfEciTransform getTransform(const JulianDate& utc) const;
+
+  /**
+   * Returns the full ECF/ECI transformation for each input time.  The
+   * time range is checked once for the full set of times.
+   *
+   * @param  utc  Times for which to generate the transformations
+   *
+   * @return  ECF/ECI transformations, one per input time
+   *
+   * @throws  out_of_range if any requested time is out of range
+   */
+  std::vector<EcfEciTransform>
+  getTransforms(const std::vector<JulianDate>& utc) const;
+
   /**
    * Convert an ECF position vector to ECI.
    *
@@ -182,6 +282,97 @@ public:
   eci2ecf(const JulianDate& utc, const Eigen::Matrix<double, 3, 1>& posi,
                                  const Eigen::Matrix<double, 3, 1>& veli) const;
 
+  /**
+   * Batch conversion of ECF position vectors to ECI.  The time range
+   * is checked once for the full set of times.
+   *
+   * @param  utc   UTC times, one per column of posf
+   * @param  posf  Cartesian ECF position vectors, one per column
+   *
+   * @return  Cartesian ECI position vectors of same units as input
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 3, Eigen::Dynamic>
+  ecf2eci(const std::vector<JulianDate>& utc,
+          const Eigen::Matrix<double, 3, Eigen::Dynamic>& posf) const;
+
+  /**
+   * Batch conversion of ECF state vectors to ECI.
+   *
+   * @param  utc   UTC times, one per column of xecf
+   * @param  xecf  Cartesian ECF state vectors, DU and DU/TU, one per column
+   *
+   * @return  Cartesian ECI state vectors, DU and DU/TU
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 6, Eigen::Dynamic>
+  ecf2eci(const std::vector<JulianDate>& utc,
+          const Eigen::Matrix<double, 6, Eigen::Dynamic>& xecf) const;
+
+  /**
+   * As above, with the output written to caller provided storage.
+   *
+   * @param  utc   UTC times, one per column of xecf
+   * @param  xecf  Cartesian ECF state vectors
+   * @param  xeci  Output ECI state vectors.  May be the
+   *               same storage as xecf.
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  void ecf2eci(const std::vector<JulianDate>& utc,
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xecf,
+      Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xeci) const;
+
+  /**
+   * Batch conversion of ECI position vectors to ECF.
+   *
+   * @param  utc   UTC times, one per column of posi
+   * @param  posi  Cartesian ECI position vectors, one per column
+   *
+   * @return  Cartesian ECF position vectors of same units as input
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 3, Eigen::Dynamic>
+  eci2ecf(const std::vector<JulianDate>& utc,
+          const Eigen::Matrix<double, 3, Eigen::Dynamic>& posi) const;
+
+  /**
+   * Batch conversion of ECI state vectors to ECF.
+   *
+   * @param  utc   UTC times, one per column of xeci
+   * @param  xeci  Cartesian ECI state vectors, DU and DU/TU, one per column
+   *
+   * @return  Cartesian ECF state vectors, DU and DU/TU
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 6, Eigen::Dynamic>
+  eci2ecf(const std::vector<JulianDate>& utc,
+          const Eigen::Matrix<double, 6, Eigen::Dynamic>& xeci) const;
+
+  /**
+   * As above, with the output written to caller provided storage.
+   *
+   * @param  utc   UTC times, one per column of xeci
+   * @param  xeci  Cartesian ECI state vectors
+   * @param  xecf  Output ECF state vectors.  May be the
+   *               same storage as xeci.
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  void eci2ecf(const std::vector<JulianDate>& utc,
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xeci,
+      Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xecf) const;
+
   /**
    * Convert an ECF position and velocity state vector to true equator
    * true equinox (TEME) using the IAU 1982 gmst angular rotation.
@@ -229,6 +420,113 @@ public:
   teme2ecf(const JulianDate& utc,
            const Eigen::Matrix<double, 3, 1>& posi) const;
 
+  /**
+   * Batch conversion of TEME state vectors to ECF.
+   *
+   * @param  utc    UTC times, one per column of xteme
+   * @param  xteme  Cartesian TEME state vectors, DU and DU/TU, one
+   *                per column
+   *
+   * @return  Cartesian ECF state vectors, DU and DU/TU
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 6, Eigen::Dynamic>
+  teme2ecf(const std::vector<JulianDate>& utc,
+           const Eigen::Matrix<double, 6, Eigen::Dynamic>& xteme) const;
+
+  /**
+   * As above, with the output written to caller provided storage.
+   *
+   * @param  utc    UTC times, one per column of xteme
+   * @param  xteme  Cartesian TEME state vectors
+   * @param  xecf   Output ECF state vectors.  May be the
+   *                same storage as xteme.
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  void teme2ecf(const std::vector<JulianDate>& utc,
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xteme,
+      Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xecf) const;
+
+  /**
+   * Batch conversion of TEME position vectors to ECF.
+   *
+   * @param  utc    UTC times, one per column of pteme
+   * @param  pteme  Cartesian TEME position vectors, one per column
+   *
+   * @return  Cartesian ECF position vectors of same units as input
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 3, Eigen::Dynamic>
+  teme2ecf(const std::vector<JulianDate>& utc,
+           const Eigen::Matrix<double, 3, Eigen::Dynamic>& pteme) const;
+
+  /**
+   * Batch conversion of ECF state vectors to TEME.
+   *
+   * @param  utc   UTC times, one per column of xecf
+   * @param  xecf  Cartesian ECF state vectors, DU and DU/TU, one per column
+   *
+   * @return  Cartesian TEME state vectors, DU and DU/TU
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 6, Eigen::Dynamic>
+  ecf2teme(const std::vector<JulianDate>& utc,
+           const Eigen::Matrix<double, 6, Eigen::Dynamic>& xecf) const;
+
+  /**
+   * As above, with the output written to caller provided storage.
+   *
+   * @param  utc    UTC times, one per column of xecf
+   * @param  xecf   Cartesian ECF state vectors
+   * @param  xteme  Output TEME state vectors.  May be the
+   *                same storage as xecf.
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  void ecf2teme(const std::vector<JulianDate>& utc,
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xecf,
+      Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xteme) const;
+
+  /**
+   * Batch conversion of TEME state vectors directly to ECI.
+   *
+   * @param  utc    UTC times, one per column of xteme
+   * @param  xteme  Cartesian TEME state vectors, DU and DU/TU, one
+   *                per column
+   *
+   * @return  Cartesian ECI state vectors, DU and DU/TU
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  Eigen::Matrix<double, 6, Eigen::Dynamic>
+  teme2eci(const std::vector<JulianDate>& utc,
+           const Eigen::Matrix<double, 6, Eigen::Dynamic>& xteme) const;
+
+  /**
+   * As above, with the output written to caller provided storage.
+   *
+   * @param  utc    UTC times, one per column of xteme
+   * @param  xteme  Cartesian TEME state vectors
+   * @param  xeci   Output ECI state vectors.  May be the
+   *                same storage as xteme.
+   *
+   * @throws  out_of_range if any requested time is out of range
+   * @throws  invalid_argument if the number of times and vectors differ
+   */
+  void teme2eci(const std::vector<JulianDate>& utc,
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xteme,
+      Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xeci) const;
+
   /**
    * Convert a mean of date position or velocity vector to ECI (GCRF).
    *
@@ -266,14 +564,66 @@ public:
   gcrf2j2000(const Eigen::Matrix<double, 3, 1>& gcrf) const;
 
 private:
+    // Generates ECF to ECI data for the node at the given index
+  void setNode(unsigned long ndx) const;
+    // Ensures ECF to ECI data for the node at the given index exists
+  void loadNode(unsigned long ndx) const;
+    // Name of cache file given time span, rate, leap seconds, and EOP
+  std::string cacheName() const;
+    // Populate ECF to ECI data from a cache file - false if not valid.
+    // When lazy loading, the file remains mapped and is decoded by
+    // block as accessed.
+  bool readCache(const std::string& fname);
+    // Decode the cached ECF to ECI data for the node at the given index
+  void readCacheNode(const char* rec, unsigned long ndx) const;
+    // Write ECF to ECI data to a cache file
+  void writeCache(const std::string& fname) const;
+    // Range checked once for a batch of times
+  void checkRange(const std::vector<JulianDate>& utc,
+                  Eigen::Index ncol, const char* caller) const;
+    // ECF to ECI data for a time already known to be in range
+  ecf_eci interpolate(const JulianDate& utc) const;
+    // Chebyshev interpolation given the index of the node preceding utc
+  ecf_eci interpolateCip(const JulianDate& utc, unsigned long ndx) const;
+    // Cosine and sine of the earth rotation angle, advanced from the
+    // most recent directly evaluated angle.  ERA is linear in UT1, so
+    // nearby times need only a short series in the angle increment.
+  struct era_phase {
+    void at(const JulianDate& ut1, double& cera, double& sera);
+
+    JulianDate ut1_0;
+    double cos_0 {1.0};
+    double sin_0 {0.0};
+    bool valid {false};
+  };
+    // ECF/ECI transformation given data interpolated to utc
+  EcfEciTransform transform(const JulianDate& utc, const ecf_eci& f2i) const;
+    // As above, with the earth rotation angle advanced via era
+  EcfEciTransform transform(const JulianDate& utc, const ecf_eci& f2i,
+                            era_phase& era) const;
+    // Applies kernel to each of a set of times already known to be in
+    // range, with transformation parameters gathered by block
+  template<typename F>
+  void convert(const std::vector<JulianDate>& utc, F&& kernel) const;
+
   JulianDate jdStart;
   JulianDate jdStop;
+  JulianDate jdNode0;
   double rate_days {0.0};
   unsigned long nfi {0UL};
   bool interpolate_bpnpm {true};
+  bool lazy_load {false};
+  bool cheby_cip {false};
+  std::shared_ptr<eom::EopSys> m_eopSys {nullptr};
+  std::shared_ptr<const LeapSeconds> m_leapSeconds {nullptr};
 
-  std::vector<ecf_eci> f2iData;
-  std::vector<meme_eci> memeData;
+    // Populated upon construction, or by block when lazy_load is set
+  mutable std::vector<ecf_eci> f2iData;
+  mutable std::vector<meme_eci> memeData;
+  mutable std::vector<cip_pm> cipData;
+  std::unique_ptr<std::once_flag[]> m_block_loaded {nullptr};
+    // Cache file nodes are read from when lazy loading, if any
+  std::unique_ptr<MappedFile> m_cache {nullptr};
 
     // J2000 to GCRF (frame bias)
   Eigen::Quaterniond bt;
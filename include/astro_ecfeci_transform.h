@@ -0,0 +1,341 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_ECFECI_TRANSFORM_H
+#define ASTRO_ECFECI_TRANSFORM_H
+
+#include <cmath>
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+#include <cal_julian_date.h>
+
+namespace eom {
+
+/**
+ * ECF/ECI transformation evaluated for a single point in time.  The
+ * BPN, earth rotation angle, and polar motion rotations are combined
+ * once upon construction as rotation matrices so the transformation
+ * can be applied to any number of vectors valid at the same time
+ * without repeating the data lookup, interpolation, and earth rotation
+ * angle computation.  Typically created via EcfEciSys::getTransform().
+ *
+ * The IAU 1982 GMST based TEME rotation is formed from the earth
+ * rotation angle and the slowly varying GMST - ERA offset so the only
+ * transcendental functions evaluated are a single sine and cosine of
+ * the earth rotation angle.
+ */
+class EcfEciTransform {
+public:
+  /**
+   * Initialize with rotations in the ECF to ECI direction.
+   *
+   * @param  utc       Time for which this transformation is valid
+   * @param  bpn       Frame bias, precession, nutation; CIRF to GCRF
+   * @param  era       Earth rotation angle, radians; TIRF to CIRF
+   * @param  pm        Polar motion; ITRF to TIRF
+   * @param  we        Earth angular velocity, radians/TU
+   * @param  gmst_era  IAU 1982 GMST minus era, radians.  Expected to be
+   *                   small in magnitude (less than 0.1 radians within
+   *                   centuries of J2000).
+   */
+  EcfEciTransform(const JulianDate& utc,
+                  const Eigen::Quaterniond& bpn,
+                  double era,
+                  const Eigen::Quaterniond& pm,
+                  double we,
+                  double gmst_era) : EcfEciTransform(utc, bpn,
+                                                     std::cos(era),
+                                                     std::sin(era),
+                                                     pm, we, gmst_era)
+  {
+  }
+
+  /**
+   * Initialize with rotations in the ECF to ECI direction, the earth
+   * rotation angle given by its cosine and sine, e.g., when advanced
+   * incrementally between successive times.
+   *
+   * @param  utc       Time for which this transformation is valid
+   * @param  bpn       Frame bias, precession, nutation; CIRF to GCRF
+   * @param  cera      Cosine of the earth rotation angle
+   * @param  sera      Sine of the earth rotation angle
+   * @param  pm        Polar motion; ITRF to TIRF
+   * @param  we        Earth angular velocity, radians/TU
+   * @param  gmst_era  IAU 1982 GMST minus era, radians.  See above.
+   */
+  EcfEciTransform(const JulianDate& utc,
+                  const Eigen::Quaterniond& bpn,
+                  double cera,
+                  double sera,
+                  const Eigen::Quaterniond& pm,
+                  double we,
+                  double gmst_era) : m_utc {utc}, m_we {we}
+  {
+      // Series expansion of small GMST - ERA offset, truncation error
+      // well below double precision for |gmst_era| < 0.1
+    double d2 {gmst_era*gmst_era};
+    double cd {1.0 - d2/2.0*(1.0 - d2/12.0*(1.0 - d2/30.0*(1.0 - d2/56.0)))};
+    double sd {gmst_era*(1.0 - d2/6.0*(1.0 - d2/20.0*(1.0 - d2/42.0)))};
+    m_tirf2teme = rot3(cera*cd - sera*sd, sera*cd + cera*sd);
+    m_pm = pm.toRotationMatrix();
+    m_bpn_era = bpn.toRotationMatrix()*rot3(cera, sera);
+    m_f2i = m_bpn_era*m_pm;
+  }
+
+  /**
+   * @return  Time for which this transformation is valid
+   */
+  JulianDate getTime() const noexcept
+  {
+    return m_utc;
+  }
+
+  /**
+   * @return  Full ECF to ECI rotation matrix (BPN*ERA*PM)
+   */
+  const Eigen::Matrix3d& getEcf2Eci() const noexcept
+  {
+    return m_f2i;
+  }
+
+  /**
+   * Convert an ECF position vector to ECI.
+   *
+   * @param  posf  Cartesian ECF position vector
+   *
+   * @return  Cartesian ECI position vector of same units as input
+   */
+  Eigen::Matrix<double, 3, 1>
+  ecf2eci(const Eigen::Matrix<double, 3, 1>& posf) const
+  {
+    return m_f2i*posf;
+  }
+
+  /**
+   * Convert an ECF position and velocity state vector to ECI.
+   *
+   * @param  posf  Cartesian ECF position vector, DU
+   * @param  velf  Cartesian ECF velocity vector, DU/TU
+   *
+   * @return  Cartesian ECI state vector, DU and DU/TU
+   */
+  Eigen::Matrix<double, 6, 1>
+  ecf2eci(const Eigen::Matrix<double, 3, 1>& posf,
+          const Eigen::Matrix<double, 3, 1>& velf) const
+  {
+    Eigen::Matrix<double, 3, 1> pos_tirf = m_pm*posf;
+    Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, m_we};
+
+    Eigen::Matrix<double, 6, 1> xeci;
+    xeci.block<3, 1>(0, 0) = m_bpn_era*pos_tirf;
+    xeci.block<3, 1>(3, 0) = m_bpn_era*(m_pm*velf + wvec.cross(pos_tirf));
+
+    return xeci;
+  }
+
+  /**
+   * Convert an ECI position vector to ECF.
+   *
+   * @param  posi  Cartesian ECI position vector
+   *
+   * @return  Cartesian ECF position vector of same units as input
+   */
+  Eigen::Matrix<double, 3, 1>
+  eci2ecf(const Eigen::Matrix<double, 3, 1>& posi) const
+  {
+    return m_f2i.transpose()*posi;
+  }
+
+  /**
+   * Convert an ECI position and velocity state vector to ECF.
+   *
+   * @param  posi  Cartesian ECI position vector, DU
+   * @param  veli  Cartesian ECI velocity vector, DU/TU
+   *
+   * @return  Cartesian ECF state vector, DU and DU/TU
+   */
+  Eigen::Matrix<double, 6, 1>
+  eci2ecf(const Eigen::Matrix<double, 3, 1>& posi,
+          const Eigen::Matrix<double, 3, 1>& veli) const
+  {
+    Eigen::Matrix<double, 3, 1> pos_tirf = m_bpn_era.transpose()*posi;
+    Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, m_we};
+
+    Eigen::Matrix<double, 6, 1> xecf;
+    xecf.block<3, 1>(0, 0) = m_pm.transpose()*pos_tirf;
+    xecf.block<3, 1>(3, 0) = m_pm.transpose()*(m_bpn_era.transpose()*veli -
+                                               wvec.cross(pos_tirf));
+
+    return xecf;
+  }
+
+  /**
+   * Convert a TEME position vector to ECF.
+   *
+   * @param  pteme  Cartesian TEME position vector
+   *
+   * @return  Cartesian ECF position vector of same units as input
+   */
+  Eigen::Matrix<double, 3, 1>
+  teme2ecf(const Eigen::Matrix<double, 3, 1>& pteme) const
+  {
+    return m_pm.transpose()*(m_tirf2teme.transpose()*pteme);
+  }
+
+  /**
+   * Convert a TEME position and velocity state vector to ECF.
+   *
+   * @param  pteme  Cartesian TEME position vector, DU
+   * @param  vteme  Cartesian TEME velocity vector, DU/TU
+   *
+   * @return  Cartesian ECF state vector, DU and DU/TU
+   */
+  Eigen::Matrix<double, 6, 1>
+  teme2ecf(const Eigen::Matrix<double, 3, 1>& pteme,
+           const Eigen::Matrix<double, 3, 1>& vteme) const
+  {
+    Eigen::Matrix<double, 3, 1> pos_tirf = m_tirf2teme.transpose()*pteme;
+    Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, m_we};
+
+    Eigen::Matrix<double, 6, 1> xecf;
+    xecf.block<3, 1>(0, 0) = m_pm.transpose()*pos_tirf;
+    xecf.block<3, 1>(3, 0) = m_pm.transpose()*(m_tirf2teme.transpose()*vteme -
+                                               wvec.cross(pos_tirf));
+
+    return xecf;
+  }
+
+  /**
+   * Convert an ECF position and velocity state vector to TEME.
+   *
+   * @param  posf  Cartesian ECF position vector, DU
+   * @param  velf  Cartesian ECF velocity vector, DU/TU
+   *
+   * @return  Cartesian TEME state vector, DU and DU/TU
+   */
+  Eigen::Matrix<double, 6, 1>
+  ecf2teme(const Eigen::Matrix<double, 3, 1>& posf,
+           const Eigen::Matrix<double, 3, 1>& velf) const
+  {
+    Eigen::Matrix<double, 3, 1> pos_tirf = m_pm*posf;
+    Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, m_we};
+
+    Eigen::Matrix<double, 6, 1> xteme;
+    xteme.block<3, 1>(0, 0) = m_tirf2teme*pos_tirf;
+    xteme.block<3, 1>(3, 0) = m_tirf2teme*(m_pm*velf + wvec.cross(pos_tirf));
+
+    return xteme;
+  }
+
+  /**
+   * Convert a TEME position vector directly to ECI.  Polar motion and
+   * the earth rotation rate cancel, leaving only the rotation between
+   * the equinox and CIO.
+   *
+   * @param  pteme  Cartesian TEME position vector
+   *
+   * @return  Cartesian ECI position vector of same units as input
+   */
+  Eigen::Matrix<double, 3, 1>
+  teme2eci(const Eigen::Matrix<double, 3, 1>& pteme) const
+  {
+    return m_bpn_era*(m_tirf2teme.transpose()*pteme);
+  }
+
+  /**
+   * Convert a TEME position and velocity state vector directly to ECI.
+   *
+   * @param  pteme  Cartesian TEME position vector, DU
+   * @param  vteme  Cartesian TEME velocity vector, DU/TU
+   *
+   * @return  Cartesian ECI state vector, DU and DU/TU
+   */
+  Eigen::Matrix<double, 6, 1>
+  teme2eci(const Eigen::Matrix<double, 3, 1>& pteme,
+           const Eigen::Matrix<double, 3, 1>& vteme) const
+  {
+    Eigen::Matrix3d teme2gcrf {m_bpn_era*m_tirf2teme.transpose()};
+
+    Eigen::Matrix<double, 6, 1> xeci;
+    xeci.block<3, 1>(0, 0) = teme2gcrf*pteme;
+    xeci.block<3, 1>(3, 0) = teme2gcrf*vteme;
+
+    return xeci;
+  }
+
+  /**
+   * Convert an ECI position and velocity state vector directly to TEME.
+   *
+   * @param  posi  Cartesian ECI position vector, DU
+   * @param  veli  Cartesian ECI velocity vector, DU/TU
+   *
+   * @return  Cartesian TEME state vector, DU and DU/TU
+   */
+  Eigen::Matrix<double, 6, 1>
+  eci2teme(const Eigen::Matrix<double, 3, 1>& posi,
+           const Eigen::Matrix<double, 3, 1>& veli) const
+  {
+    Eigen::Matrix3d gcrf2teme {m_tirf2teme*m_bpn_era.transpose()};
+
+    Eigen::Matrix<double, 6, 1> xteme;
+    xteme.block<3, 1>(0, 0) = gcrf2teme*posi;
+    xteme.block<3, 1>(3, 0) = gcrf2teme*veli;
+
+    return xteme;
+  }
+
+  /**
+   * Convert the acceleration vector from a central body gravity model
+   * to full ECF.
+   *
+   * @param  r_s_o_f  Position w.r.t. the center of earth in ECF coordinates
+   * @param  v_s_f_f  Velocity w.r.t. ECF in ECF coordinates
+   * @param  a_s_i_f  Acceleration w.r.t. ECI in ECF coordinates
+   *
+   * @return  Acceleration w.r.t. ECF in ECF coordinates
+   */
+  Eigen::Matrix<double, 3, 1>
+  gravity2ecf(const Eigen::Matrix<double, 3, 1>& r_s_o_f,
+              const Eigen::Matrix<double, 3, 1>& v_s_f_f,
+              const Eigen::Matrix<double, 3, 1>& a_s_i_f) const
+  {
+    Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, m_we};
+      // Instantaneous spin axis coordinates 'w' (Polar motion)
+    Eigen::Matrix<double, 3, 1> r_s_o_w = m_pm*r_s_o_f;
+    Eigen::Matrix<double, 3, 1> v_s_f_w = m_pm*v_s_f_f;
+    Eigen::Matrix<double, 3, 1> da_s_f_w = 2.0*wvec.cross(v_s_f_w) +
+                                               wvec.cross(wvec.cross(r_s_o_w));
+
+    return a_s_i_f - m_pm.transpose()*da_s_f_w;
+  }
+
+private:
+    // Rotation about the z-axis by an angle given its cosine and sine
+  static Eigen::Matrix3d rot3(double c, double s)
+  {
+    Eigen::Matrix3d mtx;
+    mtx << c,  -s,  0.0,
+           s,   c,  0.0,
+           0.0, 0.0, 1.0;
+    return mtx;
+  }
+
+  JulianDate m_utc;
+  double m_we {0.0};
+  Eigen::Matrix3d m_pm;                 // ITRF to TIRF
+  Eigen::Matrix3d m_bpn_era;            // TIRF to GCRF
+  Eigen::Matrix3d m_f2i;                // ITRF to GCRF
+  Eigen::Matrix3d m_tirf2teme;          // TIRF to TEME
+};
+
+
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_ENSEMBLE_DEQ_H
+#define ASTRO_ENSEMBLE_DEQ_H
+
+#include <memory>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <mth_ode.h>
+#include <cal_julian_date.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_cursor.h>
+#include <astro_gravity_std_batch.h>
+#include <astro_force_model.h>
+
+namespace eom {
+
+/**
+ * Differential equations for orbital motion of an ensemble of
+ * satellites sharing a common time.  The ECF/ECI transformation and
+ * any terms common to all members of the ensemble (e.g., third body
+ * positions) are evaluated once per call, while the central body
+ * gravity model is evaluated for all members in batch.  Per member,
+ * results match Deq with the equivalent GravityStd model.
+ */
+class EnsembleDeq {
+public:
+  ~EnsembleDeq() = default;
+  EnsembleDeq(const EnsembleDeq&) = delete;
+  EnsembleDeq& operator=(const EnsembleDeq&) = delete;
+  EnsembleDeq(EnsembleDeq&&) = default;
+  EnsembleDeq& operator=(EnsembleDeq&&) = default;
+
+  /**
+   * Initialize with gravity model and earth transformation service.
+   * The number of ensemble members is set by the gravity model lanes.
+   *
+   * @param  grav    Gravity model to take possesion of
+   * @param  ecfeci  ECF/ECI conversion resource
+   */
+  EnsembleDeq(std::unique_ptr<GravityStdBatch> grav,
+              std::shared_ptr<const EcfEciSys> ecfeci);
+
+  /**
+   * @return  Number of ensemble members
+   */
+  int getMembers() const noexcept
+  {
+    return m_grav->getLanes();
+  }
+
+  /**
+   * Compute derivatives of state vectors
+   *
+   * @param  utc     time
+   * @param  x       ECI State vectors (position and velocity), one
+   *                 per column
+   * @param  xdot    Output time derivatives of state vectors (velocity
+   *                 and acceleration), one per column
+   * @param  method  Predictor/corrector option, see Deq::getXdot()
+   *
+   * @throws  invalid_argument if x or xdot does not have one column
+   *          per ensemble member.
+   */
+  void getXdot(const JulianDate& utc,
+               const Eigen::Matrix<double, 6, Eigen::Dynamic>& x,
+               Eigen::Matrix<double, 6, Eigen::Dynamic>& xdot,
+               OdeEvalMethod method = OdeEvalMethod::predictor);
+
+  /**
+   * Add additional force models to the EOM.  Possession of the
+   * unique_ptr is taken.
+   *
+   * @param  Additional force model, moved to this class
+   */
+  void addForceModel(std::unique_ptr<ForceModel> fm);
+
+private:
+  std::shared_ptr<const EcfEciSys> m_ecfeci {nullptr};
+  EcfEciCursor m_f2i_cursor;
+  std::unique_ptr<GravityStdBatch> m_grav {nullptr};
+  std::vector<std::unique_ptr<ForceModel>> m_fmodels;
+    // Working storage, ECF position and acceleration
+  Eigen::Matrix<double, 3, Eigen::Dynamic> m_posf;
+  Eigen::Matrix<double, 3, Eigen::Dynamic> m_accf;
+  Eigen::Matrix<double, 3, Eigen::Dynamic> m_acci;
+};
+
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_ENSEMBLE_RK4_H
+#define ASTRO_ENSEMBLE_RK4_H
+
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <astro_ensemble_deq.h>
+
+namespace eom {
+
+/**
+ * Propagates the equations of motion for an ensemble of satellites in
+ * lockstep, on a shared time grid, using an RK4 integrator.  Each
+ * member follows the same sequence of operations as Rk4, so results
+ * match those of individually propagated members.
+ */
+class EnsembleRk4 {
+public:
+  ~EnsembleRk4() = default;
+  EnsembleRk4(const EnsembleRk4&) = delete;
+  EnsembleRk4& operator=(const EnsembleRk4&) = delete;
+  EnsembleRk4(EnsembleRk4&&) = default;
+  EnsembleRk4& operator=(EnsembleRk4&&) = default;
+
+  /**
+   * Initialize with equations of motion, fixed step size, and initial
+   * states of the ensemble members.
+   *
+   * @param  deq  Equations of motion
+   * @param  dt   Integration step size.  May be negative.
+   * @param  jd   State vector epoch shared by all members
+   * @param  x    Initial conditions - state vectors at epoch, one per
+   *              column
+   *
+   * @throws  invalid_argument if x does not have one column per
+   *          ensemble member.
+   */
+  EnsembleRk4(std::unique_ptr<EnsembleDeq> deq,
+              const Duration& dt,
+              const JulianDate& jd,
+              const Eigen::Matrix<double, 6, Eigen::Dynamic>& x);
+
+  /**
+   * @return  Time associated with current state vectors and
+   *          derivatives, UTC
+   */
+  JulianDate getT() const noexcept
+  {
+    return m_jd;
+  }
+
+  /**
+   * @return  Current state vectors, one per column, DU, DU/TU
+   */
+  const Eigen::Matrix<double, 6, Eigen::Dynamic>& getX() const noexcept
+  {
+    return m_x;
+  }
+
+  /**
+   * @return  Time derivative of current state vectors, one per column,
+   *          DU/TU, DU/TU^2
+   */
+  const Eigen::Matrix<double, 6, Eigen::Dynamic>& getXdot() const noexcept
+  {
+    return m_dx;
+  }
+
+  /**
+   * Propagate all members by the integration step size.
+   *
+   * @return   Time associated with propagated states.
+   */
+  JulianDate step();
+
+private:
+  std::unique_ptr<EnsembleDeq> m_deq {nullptr};
+  Duration m_dt;
+  JulianDate m_jd;
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_x;
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_dx;
+    // Working storage for step()
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_x0;
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_xd;
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_xx;
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_xa;
+  Eigen::Matrix<double, 6, Eigen::Dynamic> m_q;
+};
+
+
+}
+
+#endif
@@ -9,6 +9,7 @@
 #ifndef ASTRO_EOP_SYS_H
 #define ASTRO_EOP_SYS_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -45,7 +46,9 @@ public:
    * (IAU2000) version metadata link to the finals2000A.all.csv file.
    *
    * The first column is expected to be an integer MJD value, with each
-   * line of data separated by one day.
+   * line of data separated by one day.  The file is memory mapped and
+   * records are located by binary search on MJD, so only the records
+   * spanning the requested time period are parsed.
    *
    * @param  fname        Filename to open and close, from which to
    *                      parse IERS data.  The IERS "csv" semicolon
@@ -54,9 +57,19 @@ public:
    *                      IERS EOP data.
    * @param  stopTime     Latest UTC time for which to parse and store
    *                      IERS EOP data.
+   * @param  cache_dir    If not empty, directory of binary EOP files.
+   *                      Data are loaded from the binary file matching
+   *                      the name, size, and modification time of fname,
+   *                      if present.  Otherwise, all records of fname
+   *                      are parsed and written to a new binary file.
+   *                      Failure to write the file is not an error.
+   *
+   * @throws  runtime_error if the file can't be opened, is not of the
+   *          expected format, or doesn't span the requested time period
    */
   EopSys(std::string fname,
-         const JulianDate& startTime, const JulianDate& stopTime);
+         const JulianDate& startTime, const JulianDate& stopTime,
+         const std::string& cache_dir = "");
 
   /**
    * @return  EOP for the requested time.  Daily published values are
@@ -64,9 +77,35 @@ public:
    */
   eop_record getEop(const JulianDate& jd) const;
 
+  /**
+   * @return  Hash of the EOP data stored by this object.  Equal hash
+   *          values indicate the same EOP data over the same time span.
+   */
+  std::uint64_t getHash() const noexcept
+  {
+    return m_hash;
+  }
+
 private:
+    // Parse the IERS file, writing all records to cache_file if not empty
+  void parse(const std::string& fname, const std::string& cache_file);
+    // Store the records spanning mjd_first to mjd_last
+  void setSpan(const std::vector<eop_record>& records);
+    // Name of cache file given the IERS file
+  std::string cacheName(const std::string& fname) const;
+    // Size and modification time identifying an IERS file
+  static void sourceId(const std::string& fname,
+                       std::uint64_t& src_size, std::int64_t& src_mtime);
+    // Populate EOP data from a cache file - false if not valid
+  bool readCache(const std::string& cache_file, const std::string& fname);
+    // Write all EOP records to a cache file
+  void writeCache(const std::string& cache_file,
+                  const std::string& fname,
+                  const std::vector<eop_record>& records) const;
+
   unsigned long mjd_first {0UL};
   unsigned long mjd_last {0UL};
+  std::uint64_t m_hash {0};
   std::vector<eop_record> eopData;
 };
 
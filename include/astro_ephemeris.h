@@ -10,10 +10,13 @@
 #define ASTRO_EPHEMERIS_H
 
 #include <string>
+#include <vector>
+#include <stdexcept>
 
 #include <Eigen/Dense>
 
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 
 namespace eom {
 
@@ -96,6 +99,102 @@ public:
    */
   virtual Eigen::Matrix<double, 3, 1> getPosition(const JulianDate& jd,
                                                   EphemFrame frame) const=0;
+
+  /**
+   * Retrieve state vectors for a set of times.  Intended for dense
+   * sampling where times are typically in increasing order, allowing
+   * implementations to amortize record lookups and reference frame
+   * conversions over the full set.  The default implementation calls
+   * getStateVector() for each time.
+   *
+   * @param  jd     Times for which to return state vectors, UTC
+   * @param  frame  Reference frame of returned state vectors
+   * @param  xvec   Output Cartesian position and velocity state
+   *                vectors, DU and DU/TU, one column per input time.
+   *                Must be sized by the caller.
+   *
+   * @throws  invalid_argument if the number of columns in xvec does not
+   *          match the number of times.  out_of_range if any requested
+   *          time is not supported.
+   */
+  virtual void
+  getStateVectors(const std::vector<JulianDate>& jd, EphemFrame frame,
+                  Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+  {
+    checkStateVectors(jd, xvec.cols(), "Ephemeris");
+    for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+      xvec.col(ii) = this->getStateVector(jd[ii], frame);
+    }
+  }
+
+  /**
+   * Sample state vectors on a uniform time grid, writing to storage
+   * supplied by the caller.  The output may be larger than needed so a
+   * single buffer can be reused across requests - no allocation is
+   * performed by this method.  Implementations backed by interpolation
+   * records step through records in order rather than searching for
+   * each time.  The default implementation calls getStateVector() for
+   * each time.
+   *
+   * @param  start  Time of the first sample, UTC
+   * @param  dt     Time between samples.  May be negative.
+   * @param  n      Number of samples
+   * @param  frame  Reference frame of returned state vectors
+   * @param  xvec   Output Cartesian position and velocity state
+   *                vectors, DU and DU/TU.  The first n columns are
+   *                populated, the sample at start + i*dt in column i.
+   *
+   * @throws  invalid_argument if xvec has fewer than n columns.
+   *          out_of_range if any requested time is not supported.
+   */
+  virtual void
+  sample(const JulianDate& start, const Duration& dt, unsigned long n,
+         EphemFrame frame,
+         Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec) const
+  {
+    checkSample(n, xvec.cols(), "Ephemeris");
+    double dt_days {dt.getDays()};
+    for (unsigned long ii=0UL; ii<n; ++ii) {
+      xvec.col(ii) = this->getStateVector(start + ii*dt_days, frame);
+    }
+  }
+
+protected:
+  /**
+   * Verify output storage is consistent with the requested times.
+   *
+   * @param  jd     Times for which state vectors are requested
+   * @param  ncols  Number of columns in the output state vector storage
+   * @param  cname  Name of calling class, for error message
+   *
+   * @throws  invalid_argument if the number of columns does not match
+   */
+  static void checkStateVectors(const std::vector<JulianDate>& jd,
+                                Eigen::Index ncols, const std::string& cname)
+  {
+    if (static_cast<unsigned long>(ncols) != jd.size()) {
+      throw std::invalid_argument(cname +
+                                  "::getStateVectors() - size mismatch");
+    }
+  }
+
+  /**
+   * Verify output storage is large enough for the requested samples.
+   *
+   * @param  n      Number of samples requested
+   * @param  ncols  Number of columns in the output state vector storage
+   * @param  cname  Name of calling class, for error message
+   *
+   * @throws  invalid_argument if ncols is less than n
+   */
+  static void checkSample(unsigned long n, Eigen::Index ncols,
+                          const std::string& cname)
+  {
+    if (static_cast<unsigned long>(ncols) < n) {
+      throw std::invalid_argument(cname + "::sample() - buffer too small");
+    }
+  }
 };
 
 
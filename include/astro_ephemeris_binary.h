@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_EPHEMERIS_BINARY_H
+#define ASTRO_EPHEMERIS_BINARY_H
+
+#include <cstdint>
+
+namespace eom {
+
+/**
+ * EOM binary ephemeris file format, written by SpEphemeris::write() and
+ * read by MappedEphemeris.  Files are written in native byte order and
+ * are intended to be evaluated in place once memory mapped, so they are
+ * portable only between systems with the same byte order and floating
+ * point representation.
+ *
+ * Layout, with each section beginning at a multiple of 64 bytes:
+ *   header
+ *   Node times, nnodes pairs of doubles - the high and low portions of
+ *     each Julian date, UTC.  Polynomial ii spans node ii to ii + 1.
+ *   GCRF Hermite2Table<double, 3, C> polynomial blocks, nnodes - 1
+ *   ITRF polynomial blocks, nnodes - 1, if nframes == 2
+ *
+ * where C is double or float as indicated by coeff_bytes.  ITRF
+ * polynomials reflect the EOP used when the file was written.
+ */
+namespace eph_binary {
+  constexpr char magic[8] {'E', 'O', 'M', 'E', 'P', 'H', '\0', '\0'};
+  constexpr std::uint32_t version {1};
+  constexpr std::uint32_t byte_order {0x01020304};
+  constexpr std::uint64_t alignment {64};
+
+  struct header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t coeff_bytes;            ///< Derivative coefficient size
+    std::uint32_t nframes;                ///< 1: GCRF, 2: GCRF and ITRF
+    std::uint64_t block_bytes;            ///< Bytes per polynomial
+    std::uint64_t nnodes;                 ///< Number of node times
+    std::uint64_t times_offset;           ///< Bytes from start of file
+    std::uint64_t coeff_offset[2];        ///< GCRF, ITRF blocks
+    double epoch[2];                      ///< Epoch, JD high and low
+    double start[2];                      ///< Earliest valid time
+    double stop[2];                       ///< Latest valid time
+    double max_pos_err;                   ///< Storage error bound, DU
+    double max_vel_err;                   ///< Storage error bound, DU/TU
+  };
+
+  /**
+   * @return  Offset rounded up to the section alignment
+   */
+  constexpr std::uint64_t aligned(std::uint64_t offset) noexcept
+  {
+    return (offset + alignment - 1)/alignment*alignment;
+  }
+}
+
+
+}
+
+#endif
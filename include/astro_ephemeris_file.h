@@ -17,7 +17,8 @@ namespace eom {
  * Supported ephemeris file formats
  */
 enum class EphFileFormat {
-  sp3c                            ///< NGS Standard Product 3 format
+  sp3c,                           ///< NGS Standard Product 3 format
+  eom_binary                      ///< EOM binary Hermite ephemeris
 };
 
 /**
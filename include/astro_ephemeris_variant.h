@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_EPHEMERIS_VARIANT_H
+#define ASTRO_EPHEMERIS_VARIANT_H
+
+#include <memory>
+#include <variant>
+
+#include <astro_ephemeris.h>
+#include <astro_sp_ephemeris.h>
+#include <astro_mapped_ephemeris.h>
+#include <astro_sp3_hermite.h>
+#include <astro_sp3_chebyshev.h>
+
+namespace eom {
+
+/**
+ * Ephemeris resource resolved to its concrete type for consumers
+ * instantiated per ephemeris type, e.g., GpAccessStd.  Visiting the
+ * variant once selects an instantiation whose inner loops call the
+ * concrete (final) type directly rather than through Ephemeris
+ * virtual functions.  Buffered orbit types, where evaluation is an
+ * inexpensive polynomial lookup, are listed.  Any other ephemeris is
+ * held through the Ephemeris interface.  See resolve_ephemeris().
+ */
+using EphemerisVariant = std::variant<std::shared_ptr<const Ephemeris>,
+                                      std::shared_ptr<const SpEphemeris>,
+                                      std::shared_ptr<const MappedEphemeris>,
+                                      std::shared_ptr<const Sp3Hermite>,
+                                      std::shared_ptr<const Sp3Chebyshev>>;
+
+
+}
+
+#endif
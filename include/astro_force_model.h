@@ -41,6 +41,27 @@ public:
    */
   virtual Eigen::Matrix<double, 3, 1> getAcceleration(
           const JulianDate& jd, const Eigen::Matrix<double, 6, 1>& state) = 0;
+
+  /**
+   * Compute accelerations for a set of ECI state vectors sharing a
+   * common time, adding them to acc.  The default evaluates each state
+   * vector individually.  Models with terms common to all state
+   * vectors (e.g., a third body position) should override.
+   *
+   * @param  jd      Time of state vectors
+   * @param  states  ECI state vectors, one per column, DU, DU/TU
+   * @param  acc     Cartesian accelerations, ECI, DU/TU^2, to which
+   *                 the acceleration for each state vector is added
+   */
+  virtual void getAccelerations(
+      const JulianDate& jd,
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& states,
+      Eigen::Ref<Eigen::Matrix<double, 3, Eigen::Dynamic>> acc)
+  {
+    for (Eigen::Index ii=0; ii<states.cols(); ++ii) {
+      acc.col(ii) += getAcceleration(jd, states.col(ii));
+    }
+  }
 };
 
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_GJ8_H
+#define ASTRO_GJ8_H
+
+#include <array>
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <mth_ode.h>
+
+#include <mth_ode_solver.h>
+
+namespace eom {
+
+/**
+ * Propagates astrodynamics equations of motion using a fixed step size
+ * 8th order summed form Gauss-Jackson (second order) predictor with
+ * summed Adams/Stormer-Cowell corrector.  Each step makes a predictor
+ * and a corrector derivative evaluation, the latter flagged via
+ * OdeEvalMethod::corrector so force models may reuse expensive terms
+ * computed for the predictor.
+ *
+ * Sums are maintained at the most recent point, with coefficients
+ * derived from the backward difference operator series.  The nine
+ * point startup window, beginning at the epoch, is generated with an
+ * RKF7(8) integrator.  The first 8 calls to step() return these
+ * startup points.
+ *
+ * See Matthew M. Berry and Liam M. Healy, "Implementation of
+ * Gauss-Jackson Integration for Orbit Propagation", The Journal of
+ * the Astronautical Sciences, Vol. 52, No. 3, 2004.
+ */
+class Gj8 : public OdeSolver<JulianDate, double, 6> {
+public:
+  ~Gj8() = default;
+  Gj8(const Gj8&) = delete;
+  Gj8& operator=(const Gj8&) = delete;
+  Gj8(Gj8&&) = default;
+  Gj8& operator=(Gj8&&) = default;
+
+  /**
+   * Initialize with equations of motion, fixed step size, and initial
+   * state of the system to be integrated.  The startup window is
+   * generated.
+   *
+   * @param  deq  Equations of motion
+   * @param  dt   Integration step size.  May be negative.
+   * @param  jd   State vector epoch
+   * @param  x    Initial conditions - state vector at epoch
+   */
+  Gj8(std::unique_ptr<Ode<JulianDate, double, 6>> deq,
+      const Duration& dt,
+      const JulianDate& jd,
+      const Eigen::Matrix<double, 6, 1>& x);
+
+  /**
+   * @return  Time associated with current state vector and derivative, UTC
+   */
+  JulianDate getT() const noexcept override;
+
+  /**
+   * @return  Current state vector, DU
+   */
+  Eigen::Matrix<double, 6, 1> getX() const noexcept override;
+
+  /**
+   * @return  Time derivative of current state vector, DU, DU/TU
+   */
+  Eigen::Matrix<double, 6, 1> getXdot() const noexcept override;
+
+  /**
+   * Propagate by system integration step size.
+   *
+   * @return   Time associated with propagated state.
+   */
+  JulianDate step() override;
+
+private:
+  static constexpr int order {8};
+  std::unique_ptr<Ode<JulianDate, double, 6>> m_deq {nullptr};
+  Duration m_dt;
+  double m_h {0.0};
+  JulianDate m_jd;
+  Eigen::Matrix<double, 6, 1> m_x;
+  Eigen::Matrix<double, 6, 1> m_dx;
+    // Startup points, served by step() until m_istep reaches order
+  int m_istep {0};
+  std::array<Eigen::Matrix<double, 6, 1>, order + 1> m_xs;
+  std::array<Eigen::Matrix<double, 6, 1>, order + 1> m_dxs;
+    // Accelerations, most recent first, and first and second sums
+  std::array<Eigen::Matrix<double, 3, 1>, order + 1> m_acc;
+  Eigen::Matrix<double, 3, 1> m_s1;
+  Eigen::Matrix<double, 3, 1> m_s2;
+};
+
+
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_GRAVITY_STD_BATCH_H
+#define ASTRO_GRAVITY_STD_BATCH_H
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <mth_ode.h>
+#include <astro_egm_coeff.h>
+
+namespace eom {
+
+/**
+ * Batch form of the GravityStd spherical harmonic gravity model,
+ * evaluating the acceleration for a fixed number of positions (lanes)
+ * per call.  The associated Legendre functions, trig harmonics, and
+ * powers of re/r are stored structure of arrays style, one row per
+ * term with the lanes contiguous, so the recursions and accumulation
+ * of the spherical harmonic terms are performed across all lanes with
+ * vectorized operations.  Lanes are padded to a multiple of the block
+ * size used when accumulating the harmonic terms.  Per lane, the order
+ * of accumulation is the same as GravityStd.
+ *
+ * This implementation is not thread safe due to the cached values used
+ * for the predictor/corrector option and memory allocated for the
+ * recursively computed terms.
+ */
+class GravityStdBatch {
+public:
+  ~GravityStdBatch() = default;
+  GravityStdBatch(const GravityStdBatch&) = delete;
+  GravityStdBatch& operator=(const GravityStdBatch&) = delete;
+  GravityStdBatch(GravityStdBatch&&) = default;
+  GravityStdBatch& operator=(GravityStdBatch&&) = default;
+
+  /**
+   * Initialize with desired degree, order, and number of lanes.
+   *
+   * @param  degree  Desired degree of model
+   * @param  order   Desired order of model, order <= degree
+   * @param  lanes   Number of positions evaluated per call
+   *
+   * @throws  invalid_argument if degree and order are inconsistent
+   *          or exceed allowed dimensions, or lanes is not positive.
+   */
+  GravityStdBatch(int degree, int order, int lanes);
+
+  /**
+   * @return  Number of positions evaluated per call
+   */
+  int getLanes() const noexcept
+  {
+    return m_lanes;
+  }
+
+  /**
+   * Compute gravitational accelerations given ECEF position vectors.
+   * See GravityStd::getAcceleration().
+   *
+   * @param  pos    Cartesian ECEF position vectors, one per column,
+   *                DU
+   * @param  entry  Predictor performs spherical harmonic evaluation.
+   *                Corrector uses cached values from the previous
+   *                call and updates the central body term only.
+   * @param  acc    Output Cartesian accelerations, earth fixed
+   *                coordinates with derivatives w.r.t. the inertial
+   *                reference frame, one per column, DU/TU^2
+   *
+   * @throws  invalid_argument if pos or acc does not have one column
+   *          per lane.
+   */
+  void getAccelerations(
+      const Eigen::Ref<const Eigen::Matrix<double, 3, Eigen::Dynamic>>& pos,
+      OdeEvalMethod entry,
+      Eigen::Ref<Eigen::Matrix<double, 3, Eigen::Dynamic>> acc);
+
+private:
+    // Terms indexed by row, lanes by column
+  using LaneArray =
+      Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    // Lanes are accumulated in fixed size blocks, padded as needed
+  static constexpr int block_lanes {4};
+  using LaneBlock = Eigen::Map<const Eigen::Array<double, block_lanes, 1>>;
+  using LaneBlockOut = Eigen::Map<Eigen::Array<double, block_lanes, 1>>;
+
+  int m_degree {};
+  int m_order {};
+  int m_lanes {};
+  int m_padded {};
+  int m_alf_cols {};
+  std::vector<int> ndx_list;
+  LaneArray m_smlon;
+  LaneArray m_cmlon;
+  LaneArray m_re_r_n;
+  LaneArray m_tlat;
+    // Associated Legendre functions, (degree, order) at row
+    // degree*m_alf_cols + order
+  LaneArray m_alf;
+    // Cached partials for predictor/corrector
+  LaneArray m_gs;
+};
+
+
+}
+
+#endif
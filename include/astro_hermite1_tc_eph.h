@@ -19,6 +19,7 @@
 #include <mth_hermite1.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_hermite1_eph.h>
 
 namespace eom {
 
@@ -30,7 +31,7 @@ namespace eom {
  *
  * @author  Kurt Motekew  2023/12/31
  */
-class Hermite1TcEph : public Ephemeris {
+class Hermite1TcEph final : public Ephemeris {
 public:
   ~Hermite1TcEph() = default;
   Hermite1TcEph(const Hermite1TcEph&) = delete;
@@ -125,8 +126,8 @@ private:
   JulianDate m_jdEpoch;
   std::shared_ptr<const EcfEciSys> m_ecfeciSys {nullptr};
 
-  std::unique_ptr<Ephemeris> m_targetEph {nullptr};
-  std::unique_ptr<Ephemeris> m_centerEph {nullptr};
+  std::unique_ptr<Hermite1Eph> m_targetEph {nullptr};
+  std::unique_ptr<Hermite1Eph> m_centerEph {nullptr};
 };
 
 
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_MAPPED_EPHEMERIS_H
+#define ASTRO_MAPPED_EPHEMERIS_H
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <utl_mapped_file.h>
+#include <mth_hermite2_table.h>
+#include <astro_ephemeris.h>
+#include <astro_ecfeci_sys.h>
+
+namespace eom {
+
+/**
+ * Ephemeris read from an EOM binary ephemeris file, as written by
+ * SpEphemeris::write().  The file is memory mapped and interpolation
+ * polynomials are evaluated in place - no integration is performed and
+ * ephemeris is not copied.  Pages are shared by all processes mapping
+ * the same file.  See astro_ephemeris_binary.h.
+ */
+class MappedEphemeris final : public Ephemeris {
+public:
+  ~MappedEphemeris() = default;
+  MappedEphemeris(const MappedEphemeris&) = delete;
+  MappedEphemeris& operator=(const MappedEphemeris&) = delete;
+  MappedEphemeris(MappedEphemeris&&) = default;
+  MappedEphemeris& operator=(MappedEphemeris&&) = default;
+
+  /**
+   * Map and validate an EOM binary ephemeris file.
+   *
+   * @param  name       Unique ephemeris identifier
+   * @param  fname      EOM binary ephemeris filename
+   * @param  ecfeciSys  ECF/ECI conversion resource
+   *
+   * @throws  runtime_error if the file can't be mapped, or is not a
+   *          valid EOM binary ephemeris file of a supported version and
+   *          byte order.
+   */
+  MappedEphemeris(const std::string& name,
+                  const std::string& fname,
+                  std::shared_ptr<const EcfEciSys> ecfeciSys);
+
+  /**
+   * @return  Unique ephemeris identifier
+   */
+  std::string getName() const override
+  {
+    return m_name;
+  }
+
+  /**
+   * @return  Epoch of the ephemeris as originally generated
+   */
+  JulianDate getEpoch() const override
+  {
+    return m_jdEpoch;
+  }
+
+  /**
+   * @return  Earliest time for which ephemeris can be retrieved
+   */
+  JulianDate getBeginTime() const override
+  {
+    return m_jdStart;
+  }
+
+  /**
+   * @return  Latest time for which ephemeris can be retrieved
+   */
+  JulianDate getEndTime() const override
+  {
+    return m_jdStop;
+  }
+
+  /**
+   * @param  jd     Time of desired state vector, UTC
+   * @param  frame  Desired output reference frame
+   *
+   * @return  Cartesian state vector at requested time in the requested
+   *          reference frame, DU and DU/TU
+   *
+   * @throws  out_of_range if the requested time is out of range
+   */
+  Eigen::Matrix<double, 6, 1> getStateVector(const JulianDate& jd,
+                                             EphemFrame frame) const override;
+
+  /**
+   * @param  jd     Time of desired position vector, UTC
+   * @param  frame  Desired output reference frame
+   *
+   * @return  Cartesian position vector, DU
+   *
+   * @throws  out_of_range if the requested time is out of range
+   */
+  Eigen::Matrix<double, 3, 1> getPosition(const JulianDate& jd,
+                                          EphemFrame frame) const override;
+
+  /**
+   * See SpEphemeris::getStateVectors()
+   */
+  void
+  getStateVectors(const std::vector<JulianDate>& jd, EphemFrame frame,
+                  Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+  /**
+   * See SpEphemeris::sample()
+   */
+  void sample(const JulianDate& start, const Duration& dt, unsigned long n,
+              EphemFrame frame,
+              Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+private:
+    // Node time ii
+  JulianDate node(unsigned long ii) const noexcept
+  {
+    return JulianDate(m_times[2*ii], m_times[2*ii + 1]);
+  }
+
+    // Index of the polynomial covering jd, checking hint and the one
+    // following first.  Throws out_of_range if not covered.
+  unsigned long locate(const JulianDate& jd, unsigned long hint) const;
+
+    // Evaluate polynomial ndx for the requested frame
+  Eigen::Matrix<double, 3, 1> evalPosition(EphemFrame frame,
+                                           unsigned long ndx,
+                                           double dt) const;
+  Eigen::Matrix<double, 3, 1> evalVelocity(EphemFrame frame,
+                                           unsigned long ndx,
+                                           double dt) const;
+
+  std::string m_name {""};
+  JulianDate m_jdEpoch;
+  JulianDate m_jdStart;
+  JulianDate m_jdStop;
+  std::shared_ptr<const EcfEciSys> m_ecfeciSys {nullptr};
+
+  std::unique_ptr<MappedFile> m_file {nullptr};
+  const double* m_times {nullptr};
+  unsigned long m_nnodes {0UL};
+  bool m_compact {false};
+  bool m_ecf {false};
+  Hermite2Table<double, 3> m_eci_tbl;
+  Hermite2Table<double, 3> m_ecf_tbl;
+  Hermite2Table<double, 3, float> m_eci_compact;
+  Hermite2Table<double, 3, float> m_ecf_compact;
+};
+
+
+}
+
+#endif
@@ -40,7 +40,7 @@ namespace eom {
  * @author  Kurt Motekew
  * @date    2023/02/12
  */
-class MoonMeeus : public Ephemeris {
+class MoonMeeus final : public Ephemeris {
 public:
   ~MoonMeeus() = default;
   MoonMeeus(const MoonMeeus&) = default;             // copy constructor
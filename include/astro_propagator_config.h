@@ -41,7 +41,10 @@ enum class Propagator {
 #endif
   rk4,                            ///< Basic RK4 integration
   rk4s,                           ///< RK4 with time regularization
-  adams4                          ///< Adams-Bashforth-Moulton
+  adams4,                         ///< Adams-Bashforth-Moulton
+  adams,                          ///< Variable step/order ABM
+  gj8,                            ///< Summed form 8th order G-J
+  rkf78                           ///< Adaptive Runge-Kutta-Fehlberg 7(8)
 };
 
 /**
@@ -130,6 +133,11 @@ public:
 
   /**
    * @param  Set the integration method to use
+   *
+   * @throws  invalid_argument if lazy propagation with a segment limit
+   *          has been set and the integration method does not reproduce
+   *          node times when regenerating segments.  See
+   *          setLazyPropagation().
    */
   void setPropagator(Propagator integration_method);
 
@@ -160,6 +168,33 @@ public:
     return  m_dt;
   }
 
+  /**
+   * Set local truncation error tolerances for adaptive step size
+   * integrators.  The step size becomes the maximum step size.
+   *
+   * @param  rel_tol  Relative error tolerance
+   * @param  abs_tol  Absolute error tolerance, DU and DU/TU
+   *
+   * @throws  invalid_argument if either tolerance is not positive
+   */
+  void setTolerance(double rel_tol, double abs_tol);
+
+  /**
+   * @return  Relative local truncation error tolerance
+   */
+  double getRelativeTolerance() const noexcept
+  {
+    return m_rel_tol;
+  }
+
+  /**
+   * @return  Absolute local truncation error tolerance
+   */
+  double getAbsoluteTolerance() const noexcept
+  {
+    return m_abs_tol;
+  }
+
   /**
    * @param  Set the gravity model to use
    */
@@ -213,6 +248,96 @@ public:
     return m_other_gravity;
   }
 
+  /**
+   * When called, SP ephemeris stores interpolators in both the ECI and
+   * ECF frames so ECF requests do not require a frame conversion.
+   */
+  void enableEcfInterpolation() noexcept;
+
+  /**
+   * @return  true if ECF interpolators should also be generated
+   */
+  bool ecfInterpolationEnabled() const noexcept
+  {
+    return m_ecf_interp;
+  }
+
+  /**
+   * When called, SP ephemeris interpolators are stored in compact form,
+   * with derivative coefficients in single precision.  See SpEphemeris.
+   */
+  void enableCompactStorage() noexcept;
+
+  /**
+   * @return  true if SP ephemeris should be stored in compact form
+   */
+  bool compactStorageEnabled() const noexcept
+  {
+    return m_compact;
+  }
+
+  /**
+   * When called, SP ephemeris is generated lazily, in segments of the
+   * given duration, as requested rather than over the full span upon
+   * creation.
+   *
+   * @param  seg           Duration of each segment
+   * @param  max_segments  Maximum number of segments held in memory,
+   *                       zero for no limit.  Released segments are
+   *                       regenerated when needed, so a limit requires
+   *                       an integrator that reproduces the original
+   *                       node times - not the adaptive RKF78 or
+   *                       variable step/order Adams methods.
+   *
+   * @throws  invalid_argument if the segment duration is not positive
+   *          or a segment limit is given with an incompatible
+   *          integration method
+   */
+  void setLazyPropagation(const Duration& seg,
+                          unsigned long max_segments = 0UL);
+
+  /**
+   * @return  true if SP ephemeris should be generated lazily
+   */
+  bool lazyPropagationEnabled() const noexcept
+  {
+    return m_lazy;
+  }
+
+  /**
+   * @return  Duration of lazily generated SP ephemeris segments
+   */
+  Duration getLazySegment() const noexcept
+  {
+    return m_lazy_seg;
+  }
+
+  /**
+   * @return  Maximum number of lazily generated segments to retain,
+   *          zero for no limit
+   */
+  unsigned long getMaxLazySegments() const noexcept
+  {
+    return m_max_lazy_segs;
+  }
+
+  /**
+   * When called, the orbit may be propagated in lockstep with other
+   * orbits sharing the same epoch and compatible configuration as an
+   * ensemble, with force models evaluated for all members at once.
+   * Applies to the RK4 integrator with the standard gravity model,
+   * without lazy propagation.  Otherwise ignored.
+   */
+  void enableEnsemble() noexcept;
+
+  /**
+   * @return  true if ensemble propagation is requested
+   */
+  bool ensembleEnabled() const noexcept
+  {
+    return m_ensemble;
+  }
+
   /**
    * Order <= Degree
    *
@@ -238,6 +363,9 @@ public:
   }
 
 private:
+    // True if integration nodes depend only on the starting state
+  static bool fixedNodes(Propagator integration_method) noexcept;
+
     // Required for all propagators
   PropagatorType m_prop_type {PropagatorType::kepler1};
     // Typically required only for SP methods to set integration limits
@@ -246,11 +374,21 @@ private:
     // Integration method and step size
   Propagator m_propagator {Propagator::rk4};
   Duration m_dt;
+  double m_rel_tol {1.0e-12};
+  double m_abs_tol {1.0e-12};
     // Gravity model
   GravityModel m_gravity_model {GravityModel::jn};
   SunGravityModel m_sun_gravity {SunGravityModel::none};
   MoonGravityModel m_moon_gravity {MoonGravityModel::none};
   bool m_other_gravity {false};
+    // Ephemeris storage
+  bool m_ecf_interp {false};
+  bool m_compact {false};
+  bool m_lazy {false};
+  Duration m_lazy_seg;
+  unsigned long m_max_lazy_segs {0UL};
+    // Lockstep propagation with compatible orbits
+  bool m_ensemble {false};
 
   int m_degree {0};
   int m_order {0};
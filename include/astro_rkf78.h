@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ASTRO_RKF78_H
+#define ASTRO_RKF78_H
+
+#include <memory>
+
+#include <Eigen/Dense>
+
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <mth_ode.h>
+
+#include <mth_ode_solver.h>
+
+namespace eom {
+
+/**
+ * Propagates astrodynamics equations of motion using an adaptive step
+ * size Runge-Kutta-Fehlberg 7(8) integrator.  The step size is chosen
+ * to keep the local truncation error within the requested relative and
+ * absolute tolerances, growing through the slowly varying portions of
+ * an eccentric orbit and shrinking near perigee.
+ *
+ * Steps are limited to a maximum size so that ephemeris interpolated
+ * between integration nodes remains accurate.
+ */
+class Rkf78 : public OdeSolver<JulianDate, double, 6> {
+public:
+  ~Rkf78() = default;
+  Rkf78(const Rkf78&) = delete;
+  Rkf78& operator=(const Rkf78&) = delete;
+  Rkf78(Rkf78&&) = default;
+  Rkf78& operator=(Rkf78&&) = default;
+
+  /**
+   * Initialize with equations of motion, maximum step size, error
+   * tolerances, and initial state of the system to be integrated.
+   *
+   * @param  deq      Equations of motion
+   * @param  dt       Maximum integration step size.  The sign sets the
+   *                  direction of integration.  Also used as the
+   *                  initial step size.
+   * @param  jd       State vector epoch
+   * @param  x        Initial conditions - state vector at epoch
+   * @param  rel_tol  Relative local truncation error tolerance
+   * @param  abs_tol  Absolute local truncation error tolerance, DU
+   *                  and DU/TU
+   *
+   * @throws  invalid_argument if tolerances are not positive
+   */
+  Rkf78(std::unique_ptr<Ode<JulianDate, double, 6>> deq,
+        const Duration& dt,
+        const JulianDate& jd,
+        const Eigen::Matrix<double, 6, 1>& x,
+        double rel_tol,
+        double abs_tol);
+
+  /**
+   * @return  Time associated with current state vector and derivative, UTC
+   */
+  JulianDate getT() const noexcept override;
+
+  /**
+   * @return  Current state vector, DU
+   */
+  Eigen::Matrix<double, 6, 1> getX() const noexcept override;
+
+  /**
+   * @return  Time derivative of current state vector, DU, DU/TU
+   */
+  Eigen::Matrix<double, 6, 1> getXdot() const noexcept override;
+
+  /**
+   * Propagate by the largest step, up to the maximum step size, that
+   * satisfies the error tolerances.
+   *
+   * @return   Time associated with propagated state.
+   *
+   * @throws  runtime_error if the step size required to satisfy the
+   *          error tolerances becomes vanishingly small
+   */
+  JulianDate step() override;
+
+private:
+  std::unique_ptr<Ode<JulianDate, double, 6>> m_deq {nullptr};
+  double m_dt_max {0.0};
+  double m_dt {0.0};
+  double m_rel_tol {0.0};
+  double m_abs_tol {0.0};
+  JulianDate m_jd;
+  Eigen::Matrix<double, 6, 1> m_x;
+  Eigen::Matrix<double, 6, 1> m_dx;
+};
+
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 #define ASTRO_SGP4_H
 
 #include <string>
+#include <vector>
 #include <array>
 #include <memory>
 
@@ -19,6 +20,7 @@
 
 #include <phy_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
 #include <astro_tle.h>
@@ -127,7 +129,54 @@ public:
    */
   Eigen::Matrix<double, 3, 1> getPosition(const JulianDate& jd,
                                           EphemFrame frame) const override;
+
+  /**
+   * Propagate to a set of times, performing reference frame
+   * conversions as a single pass.
+   *
+   * @param  jd     Times of desired state vectors, UTC
+   * @param  frame  Desired output reference frame
+   * @param  xvec   Output Cartesian state vectors, DU and DU/TU, one
+   *                column per time
+   *
+   * @throws  invalid_argument if xvec and jd sizes differ.  out_of_range
+   *          if any requested time is out of range (ECF/ECI
+   *          transformation data availability).
+   */
+  void
+  getStateVectors(const std::vector<JulianDate>& jd, EphemFrame frame,
+                  Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+  /**
+   * Propagate to a uniform time grid.  Reference frame conversions
+   * share a single EcfEciCursor, so the EOP interpolation interval and
+   * earth rotation angle carry forward from one sample to the next
+   * rather than being located and evaluated anew.  No allocation is
+   * performed.
+   *
+   * @param  start  Time of the first sample, UTC
+   * @param  dt     Time between samples
+   * @param  n      Number of samples
+   * @param  frame  Desired output reference frame
+   * @param  xvec   Output Cartesian state vectors, DU and DU/TU, with
+   *                at least n columns
+   *
+   * @throws  invalid_argument if xvec has fewer than n columns.
+   *          out_of_range if any requested time is out of range (ECF/ECI
+   *          transformation data availability).
+   */
+  void sample(const JulianDate& start, const Duration& dt, unsigned long n,
+              EphemFrame frame,
+              Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
 private:
+    // Propagate to jd, TEME, DU and DU/TU.  The satrec is updated by
+    // SGP4, so a copy of m_satrec is supplied by the caller.
+  Eigen::Matrix<double, 6, 1> propagate(elsetrec& satrec,
+                                        const JulianDate& jd) const;
+
   std::string m_name;
   Tle m_tle;
   JulianDate m_jd0;
@@ -16,6 +16,7 @@
 #include <Eigen/Dense>
 
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <astro_granule.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
@@ -54,7 +55,7 @@ struct sp3_granule {
  *
  * @author  Kurt Motekew  2023/02/28
  */
-class Sp3Chebyshev : public Ephemeris {
+class Sp3Chebyshev final : public Ephemeris {
 public:
   ~Sp3Chebyshev() = default;
   Sp3Chebyshev(const Sp3Chebyshev&) = delete;
@@ -139,6 +140,46 @@ public:
   Eigen::Matrix<double, 3, 1> getPosition(const JulianDate& jd,
                                           EphemFrame frame) const override;
 
+  /**
+   * Interpolate state vectors from stored ephemeris for a set of times.
+   * Record lookups are seeded by the previous time and ECF to ECI
+   * conversions are performed as a single pass.
+   *
+   * @param  jd     Times of desired state vectors, UTC
+   * @param  frame  Desired output reference frame
+   * @param  xvec   Output Cartesian state vectors, DU and DU/TU, one
+   *                column per time
+   *
+   * @throws  invalid_argument if xvec and jd sizes differ.  out_of_range
+   *          if any requested time is out of range
+   */
+  void
+  getStateVectors(const std::vector<JulianDate>& jd, EphemFrame frame,
+                  Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+  /**
+   * Interpolate state vectors on a uniform time grid.  Interpolation
+   * records are stepped through in order.  ECF to ECI conversions
+   * share a single EcfEciCursor, so the EOP interpolation interval and
+   * earth rotation angle carry forward from one sample to the next.
+   * No allocation is performed.
+   *
+   * @param  start  Time of the first sample, UTC
+   * @param  dt     Time between samples
+   * @param  n      Number of samples
+   * @param  frame  Desired output reference frame
+   * @param  xvec   Output Cartesian state vectors, DU and DU/TU, with
+   *                at least n columns
+   *
+   * @throws  invalid_argument if xvec has fewer than n columns.
+   *          out_of_range if any requested time is out of range
+   */
+  void sample(const JulianDate& start, const Duration& dt, unsigned long n,
+              EphemFrame frame,
+              Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
 private:
   std::string m_name {""};
   JulianDate m_jdStart;
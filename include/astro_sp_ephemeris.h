@@ -9,18 +9,22 @@
 #ifndef ASTRO_SP_EPHEMERIS_H
 #define ASTRO_SP_EPHEMERIS_H
 
+#include <array>
+#include <functional>
 #include <string>
 #include <vector>
 #include <memory>
+#include <shared_mutex>
 
 #include <Eigen/Dense>
 
 #include <cal_julian_date.h>
-#include <mth_hermite2.h>
+#include <cal_duration.h>
+#include <mth_hermite2_table.h>
+#include <mth_index_mapper.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
 #include <mth_ode_solver.h>
-#include <mth_index_mapper.h>
 
 namespace eom {
 
@@ -45,30 +49,34 @@ struct eph_record {
 };
 
 /**
- * Interpolation records generated from ephemeris
+ * Creates an integrator with force model (EOM) initialized with the
+ * given time and ECI state (DU and DU/TU), stepping forward in time if
+ * the boolean is true, otherwise backward.  Returns nullptr if the
+ * direction is not supported.
  */
-struct interp_record {
-  JulianDate jd1;                           ///< Interpolator start time
-  JulianDate jd2;                           ///< Interpolator stop time
-  Hermite2<double, 3> hItp;                 ///< Interpolator
-
-  interp_record(const JulianDate& jdStart,
-                const JulianDate& jdEnd,
-                const Hermite2<double, 3>& hInterp) : jd1(jdStart),
-                                                      jd2(jdEnd),
-                                                      hItp(hInterp)
-  {
-  }
-};
+using SpSolverFactory =
+    std::function<std::unique_ptr<OdeSolver<JulianDate, double, 6>>(
+        const JulianDate&, const Eigen::Matrix<double, 6, 1>&, bool)>;
 
 /**
  * Generates ephemeris through special perturbations methods and stores
  * as interpolators for retrieval.  Position, velocity, and acceleration
  * are used to form Hermite interpolators.
  *
+ * By default, ephemeris covering the full requested span is generated
+ * upon construction.  Alternatively, ephemeris may be generated lazily,
+ * in fixed duration segments extending outward from the epoch, as
+ * requests arrive.  Integrators are held at the boundary of the last
+ * segment generated in each direction, so each segment is integrated
+ * once.  Segments already generated are shared by concurrent readers,
+ * while extending the ephemeris is serialized.  Optionally, the number
+ * of resident segments may be capped, in which case the segments
+ * furthest from the most recent request are released and regenerated
+ * from the saved boundary state if needed again.
+ *
  * @author  Kurt Motekew  2022/12/26
  */
-class SpEphemeris : public Ephemeris {
+class SpEphemeris final : public Ephemeris {
 public:
   ~SpEphemeris() = default;
   SpEphemeris(const SpEphemeris&) = delete;
@@ -78,21 +86,129 @@ public:
 
   /**
    * Initialize with orbital state and model/integrator.  Generate
-   * ephemeris from jdStart to jdStop.
+   * ephemeris from jdStart to jdStop.  When the epoch follows jdStart,
+   * a second integrator stepping backward in time may be supplied.
+   * The forward and backward legs are then integrated concurrently
+   * and joined into a single ephemeris.
    *
    * @param  name       Unique ephemeris identifier
    * @param  jdStart    Start time for which ephemeris should be created
    * @param  jdStop     End time for which ephemeris should be created
    * @param  ecfeciSys  ECF/ECI conversion resource
    * @param  sp         Integrator with force model (EOM) used to
-   *                    generate ephemeris.  SpEphemeris takes
-   *                    ownership.
+   *                    generate ephemeris forward from the epoch.
+   *                    SpEphemeris takes ownership.
+   * @param  sp_back    Integrator with force model (EOM), initialized
+   *                    with the same epoch and state as sp, but with a
+   *                    negative step size.  Used to generate ephemeris
+   *                    backward from the epoch to jdStart.  May be
+   *                    nullptr, in which case ephemeris begins at the
+   *                    epoch.  Must not share state (force models,
+   *                    etc.) with sp.  SpEphemeris takes ownership.
+   * @param  ecf_interp  If true, a second set of interpolators is
+   *                     generated in the ECF frame so ECF requests are
+   *                     evaluated directly rather than converted from
+   *                     ECI.  Roughly doubles memory use.
+   * @param  compact     If true, interpolator derivative coefficients
+   *                     are stored in single precision relative to a
+   *                     double precision position, reducing memory use
+   *                     by about 40%.  Evaluation remains in double
+   *                     precision.  The storage error is bounded as
+   *                     ephemeris is generated and must not exceed
+   *                     1 m in position or 1 cm/s in velocity per
+   *                     component.
+   *
+   * @throws  invalid_argument if no ephemeris is generated within the
+   *          requested span.  runtime_error if an integrator fails to
+   *          step in the expected direction, or if the compact storage
+   *          error bound is exceeded.
    */
   SpEphemeris(const std::string& name,
               const JulianDate& jdStart,
               const JulianDate& jdStop,
               std::shared_ptr<const EcfEciSys> ecfeciSys,
-              std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp);
+              std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp,
+              std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp_back =
+                                                                     nullptr,
+              bool ecf_interp = false,
+              bool compact = false);
+
+  /**
+   * Initialize with ephemeris records generated externally, such as by
+   * an ensemble propagator.  No integration is performed.
+   *
+   * @param  name       Unique ephemeris identifier
+   * @param  jdStart    Start time for which ephemeris should be created
+   * @param  jdStop     End time for which ephemeris should be created
+   * @param  jdEpoch    Initializing state vector time
+   * @param  ecfeciSys  ECF/ECI conversion resource
+   * @param  eph        ECI ephemeris records in increasing time order.
+   *                    Should extend a minute beyond jdStart and jdStop,
+   *                    as generated by the other constructors.  Records
+   *                    are modified when ECF interpolators are
+   *                    requested.
+   * @param  ecf_interp  See the first constructor
+   * @param  compact     See the first constructor
+   *
+   * @throws  invalid_argument if fewer than two records are supplied.
+   *          runtime_error if the compact storage error bound is
+   *          exceeded.
+   */
+  SpEphemeris(const std::string& name,
+              const JulianDate& jdStart,
+              const JulianDate& jdStop,
+              const JulianDate& jdEpoch,
+              std::shared_ptr<const EcfEciSys> ecfeciSys,
+              std::vector<eph_record>& eph,
+              bool ecf_interp = false,
+              bool compact = false);
+
+  /**
+   * Initialize with orbital state and model/integrator.  Ephemeris is
+   * generated lazily, one segment at a time, between jdStart and
+   * jdStop as requested.  No integration is performed here.
+   *
+   * @param  name          Unique ephemeris identifier
+   * @param  jdStart       Earliest time for which ephemeris may be
+   *                       requested
+   * @param  jdStop        Latest time for which ephemeris may be
+   *                       requested
+   * @param  ecfeciSys     ECF/ECI conversion resource
+   * @param  sp            Integrator used to generate ephemeris forward
+   *                       from the epoch.  SpEphemeris takes ownership.
+   * @param  sp_back       Integrator used to generate ephemeris backward
+   *                       from the epoch.  See the first constructor.
+   *                       May be nullptr.
+   * @param  seg           Duration of each segment of ephemeris
+   * @param  max_segments  Maximum number of segments to retain, zero
+   *                       for no limit.  Ignored without regen.
+   * @param  regen         Creates integrators used to regenerate
+   *                       segments released due to max_segments, in the
+   *                       same configuration as sp and sp_back.
+   *                       A regenerated segment may differ at the
+   *                       integration error level from the original
+   *                       (e.g., multistep startup), but must reproduce
+   *                       its node times - adaptive step integrators
+   *                       are not supported.  May be nullptr.
+   * @param  ecf_interp    If true, ECF interpolators are also generated
+   *                       for each segment.  See the first constructor.
+   * @param  compact       If true, interpolators are stored in compact
+   *                       form.  See the first constructor.  The error
+   *                       bound is checked as each segment is generated.
+   *
+   * @throws  invalid_argument if the segment duration is not positive
+   */
+  SpEphemeris(const std::string& name,
+              const JulianDate& jdStart,
+              const JulianDate& jdStop,
+              std::shared_ptr<const EcfEciSys> ecfeciSys,
+              std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp,
+              std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp_back,
+              const Duration& seg,
+              unsigned long max_segments = 0UL,
+              SpSolverFactory regen = nullptr,
+              bool ecf_interp = false,
+              bool compact = false);
 
   /**
    * @return  Unique ephemeris identifier
@@ -135,7 +251,8 @@ public:
    * @return  Cartesian state vector at requested time in the requested
    *          reference frame, DU and DU/TU
    *
-   * @throws  out_of_range if the requested time is out of range
+   * @throws  out_of_range if the requested time is out of range.
+   *          runtime_error if lazily generated ephemeris fails.
    */
   Eigen::Matrix<double, 6, 1> getStateVector(const JulianDate&,
                                              EphemFrame frame) const override;
@@ -146,20 +263,197 @@ public:
    *
    * @return  Cartesian position vector, DU
    *
-   * @throws  out_of_range if the requested time is out of range
+   * @throws  out_of_range if the requested time is out of range.
+   *          runtime_error if lazily generated ephemeris fails.
    */
   Eigen::Matrix<double, 3, 1> getPosition(const JulianDate& jd,
                                           EphemFrame frame) const override;
 
+  /**
+   * Interpolate state vectors from stored ephemeris for a set of times.
+   * Record lookups are seeded by the previous time and ECI to ECF
+   * conversions are performed as a single pass.
+   *
+   * @param  jd     Times of desired state vectors, UTC
+   * @param  frame  Desired output reference frame
+   * @param  xvec   Output Cartesian state vectors, DU and DU/TU, one
+   *                column per time
+   *
+   * @throws  invalid_argument if xvec and jd sizes differ.  out_of_range
+   *          if any requested time is out of range.  runtime_error if
+   *          lazily generated ephemeris fails.
+   */
+  void
+  getStateVectors(const std::vector<JulianDate>& jd, EphemFrame frame,
+                  Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+  /**
+   * Interpolate state vectors on a uniform time grid.  Interpolation
+   * records are stepped through in order.  ECI to ECF conversions
+   * share a single EcfEciCursor, so the EOP interpolation interval and
+   * earth rotation angle carry forward from one sample to the next.
+   * No allocation is performed other than by lazy generation of
+   * segments not yet resident.
+   *
+   * @param  start  Time of the first sample, UTC
+   * @param  dt     Time between samples
+   * @param  n      Number of samples
+   * @param  frame  Desired output reference frame
+   * @param  xvec   Output Cartesian state vectors, DU and DU/TU, with
+   *                at least n columns
+   *
+   * @throws  invalid_argument if xvec has fewer than n columns.
+   *          out_of_range if any requested time is out of range.
+   *          runtime_error if lazily generated ephemeris fails.
+   */
+  void sample(const JulianDate& start, const Duration& dt, unsigned long n,
+              EphemFrame frame,
+              Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                          const override;
+
+  /**
+   * Write the ephemeris to an EOM binary ephemeris file for later use
+   * via MappedEphemeris.  See astro_ephemeris_binary.h.  Lazily
+   * generated ephemeris is first generated over the full span.
+   *
+   * @param  fname  Output filename
+   *
+   * @throws  runtime_error if the file can't be written or lazily
+   *          generated ephemeris fails.
+   */
+  void write(const std::string& fname) const;
+
 private:
+    // Interpolators covering a contiguous span of ephemeris.  Node
+    // times are shared by the ECI and optional ECF interpolators, with
+    // interpolator ii spanning times[ii] to times[ii+1].  Interpolators
+    // are stored in either the full precision or compact tables.
+    // The index mapper locates interpolators without a search.
+  struct sp_segment {
+    std::vector<JulianDate> times;
+    std::unique_ptr<IndexMapper<JulianDate>> ndxr {nullptr};
+    bool compact {false};
+    bool ecf {false};
+    Hermite2Table<double, 3> eph_interpolators;
+    Hermite2Table<double, 3> ecf_interpolators;
+    Hermite2Table<double, 3, float> eph_compact;
+    Hermite2Table<double, 3, float> ecf_compact;
+
+    bool covers(const JulianDate& jd) const
+    {
+      return !(jd < times.front())  &&  !(times.back() < jd);
+    }
+
+      // Index of the interpolator covering jd, checking hint and the
+      // one following first.  Throws out_of_range if not covered.
+    unsigned long locate(const JulianDate& jd, unsigned long hint) const;
+
+      // Evaluate interpolator ndx for the requested frame, ECI if ECF
+      // interpolators are not available
+    Eigen::Matrix<double, 3, 1> getPosition(EphemFrame frame,
+                                            unsigned long ndx,
+                                            double dt) const
+    {
+      bool use_ecf {ecf  &&  frame == EphemFrame::ecf};
+      if (compact) {
+        return use_ecf ? ecf_compact.getPosition(ndx, dt) :
+                         eph_compact.getPosition(ndx, dt);
+      }
+      return use_ecf ? ecf_interpolators.getPosition(ndx, dt) :
+                       eph_interpolators.getPosition(ndx, dt);
+    }
+
+    Eigen::Matrix<double, 3, 1> getVelocity(EphemFrame frame,
+                                            unsigned long ndx,
+                                            double dt) const
+    {
+      bool use_ecf {ecf  &&  frame == EphemFrame::ecf};
+      if (compact) {
+        return use_ecf ? ecf_compact.getVelocity(ndx, dt) :
+                         eph_compact.getVelocity(ndx, dt);
+      }
+      return use_ecf ? ecf_interpolators.getVelocity(ndx, dt) :
+                       eph_interpolators.getVelocity(ndx, dt);
+    }
+
+      // Add an interpolator to the ECI or ECF table
+    void push_back(bool to_ecf, const Hermite2<double, 3>& hItp)
+    {
+      if (compact) {
+        (to_ecf ? ecf_compact : eph_compact).push_back(hItp);
+      } else {
+        (to_ecf ? ecf_interpolators : eph_interpolators).push_back(hItp);
+      }
+    }
+  };
+
+    // Lazily generated segments in one direction from the epoch
+  struct sp_leg {
+    bool forward {true};
+    unsigned long nseg {0UL};               // Segments spanning the leg
+    std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp {nullptr};
+    std::vector<eph_record> bounds;         // Start of each segment
+    std::vector<std::shared_ptr<const sp_segment>> segments;
+  };
+
+    // Lazy generation state - segments are read under a shared lock
+    // and generated or released under an exclusive lock
+  struct sp_lazy {
+    std::shared_mutex mtx;
+    double seg_days {0.0};
+    unsigned long max_segments {0UL};
+    unsigned long resident {0UL};
+    SpSolverFactory regen {nullptr};
+    std::array<sp_leg, 2> legs;             // Forward, backward
+  };
+
+    // Integrate from the current integrator state until passing jdEnd,
+    // in the direction indicated, returning records in the order
+    // generated
+  static std::vector<eph_record>
+  propagate(OdeSolver<JulianDate, double, 6>& sp, JulianDate jdEnd,
+            bool forward);
+
+    // Generate interpolators from ephemeris records in increasing time
+    // order
+  std::shared_ptr<const sp_segment>
+  buildSegment(std::vector<eph_record>& eph) const;
+
+    // Convert ECI ephemeris records to ECF and generate ECF interpolators
+  void buildEcfInterpolators(sp_segment& seg,
+                             std::vector<eph_record>& eph) const;
+
+    // Segment covering jd, generating it if lazy.  A lazily generated
+    // segment is held by hold so it remains valid while in use.
+  const sp_segment& segment(const JulianDate& jd,
+                            std::shared_ptr<const sp_segment>& hold) const;
+
+    // Locate or generate the lazy segment covering jd
+  std::shared_ptr<const sp_segment> lazySegment(const JulianDate& jd) const;
+
+    // Generate segments through k, exclusive lock held
+  void generate(sp_leg& leg, unsigned long k) const;
+
+    // Release segments furthest from leg/k until within the limit,
+    // exclusive lock held
+  void release(const sp_leg& leg, unsigned long k) const;
+
+    // Time at which segment k of the leg ends
+  JulianDate segmentEnd(const sp_leg& leg, unsigned long k) const;
+
   std::string m_name {""};
   JulianDate m_jdEpoch;
   JulianDate m_jdStart;
   JulianDate m_jdStop;
+  JulianDate m_jdBeginProp;
+  JulianDate m_jdEndProp;
   std::shared_ptr<const EcfEciSys> m_ecfeciSys {nullptr};
+  bool m_ecf_interp {false};
+  bool m_compact {false};
 
-  std::unique_ptr<IndexMapper<JulianDate>> m_ndxr {nullptr};
-  std::vector<interp_record> m_eph_interpolators;
+  std::shared_ptr<const sp_segment> m_segment {nullptr};
+  std::unique_ptr<sp_lazy> m_lazy {nullptr};
 };
 
 
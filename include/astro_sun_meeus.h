@@ -41,7 +41,7 @@ namespace eom {
  * @author  Kurt Motekew
  * @date    2023/01/30
  */
-class SunMeeus : public Ephemeris {
+class SunMeeus final : public Ephemeris {
 public:
   ~SunMeeus() = default;
   SunMeeus(const SunMeeus&) = default;             // copy constructor
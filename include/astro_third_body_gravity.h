@@ -10,6 +10,8 @@
 #define ASTRO_THIRD_BODY_GRAVITY_H
 
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include <Eigen/Dense>
 
@@ -24,10 +26,20 @@ namespace eom {
  * source and gravitational parameter.  The thrid body is treated as a
  * point source
  *
+ * The ephemeris type is a template parameter so the third body position
+ * lookup, evaluated with every force model call, is bound at compile
+ * time when a concrete (final) ephemeris type is supplied.  The default
+ * accepts any Ephemeris through the virtual interface.
+ *
+ * @tparam  E  Ephemeris type, Ephemeris or a class derived from it
+ *
  * @author  Kurt Motekew
  * @date    2023/02/05
  */
+template<typename E = Ephemeris>
 class ThirdBodyGravity : public ForceModel {
+  static_assert(std::is_base_of_v<Ephemeris, E>,
+                "ThirdBodyGravity requires an Ephemeris type");
 public:
   ~ThirdBodyGravity() = default;
   ThirdBodyGravity(const ThirdBodyGravity&) = delete;
@@ -42,7 +54,10 @@ public:
    * @param  gm   Gravitation parameter, DU^3/TU^2
    * @param  eph  Ephemeris resource
    */
-  ThirdBodyGravity(double gm, std::unique_ptr<Ephemeris> eph);
+  ThirdBodyGravity(double gm, std::unique_ptr<E> eph) : m_gm {gm},
+                                                        m_eph {std::move(eph)}
+  {
+  }
 
   /**
    * Compute third body gravitational acceleration
@@ -56,12 +71,65 @@ public:
       getAcceleration(const JulianDate& jd,
                       const Eigen::Matrix<double, 6, 1>& state) override;
 
+  /**
+   * Compute third body gravitational accelerations for a set of state
+   * vectors, looking up the third body position once.
+   *
+   * @param  jd      Time of state vectors
+   * @param  states  ECI state vectors, one per column, DU, DU/TU
+   * @param  acc     Cartesian accelerations, ECI, DU/TU^2, to which
+   *                 the acceleration for each state vector is added
+   */
+  void getAccelerations(
+      const JulianDate& jd,
+      const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& states,
+      Eigen::Ref<Eigen::Matrix<double, 3, Eigen::Dynamic>> acc) override;
+
 private:
   double m_gm {};
-  std::unique_ptr<Ephemeris> m_eph {nullptr};
+  std::unique_ptr<E> m_eph {nullptr};
 };
 
 
+template<typename E>
+Eigen::Matrix<double, 3, 1>
+    ThirdBodyGravity<E>::getAcceleration(const JulianDate& jd,
+                                      const Eigen::Matrix<double, 6, 1>& state)
+{
+  Eigen::Matrix<double, 3, 1> r_sat_o = state.block<3,1>(0,0);
+  Eigen::Matrix<double, 3, 1> r_3rd_o = m_eph->getPosition(jd,
+                                                           EphemFrame::eci);
+  Eigen::Matrix<double, 3, 1> r_sat_3rd = r_sat_o - r_3rd_o;
+
+  double r_sat_3rd3 {r_sat_3rd.norm()};
+  r_sat_3rd3 *= r_sat_3rd3*r_sat_3rd3;
+  double r_3rd_o3 {r_3rd_o.norm()};
+  r_3rd_o3 *= r_3rd_o3*r_3rd_o3;
+
+  return -1.0*m_gm*(r_sat_3rd/r_sat_3rd3 + r_3rd_o/r_3rd_o3);
+}
+
+
+template<typename E>
+void ThirdBodyGravity<E>::getAccelerations(
+    const JulianDate& jd,
+    const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& states,
+    Eigen::Ref<Eigen::Matrix<double, 3, Eigen::Dynamic>> acc)
+{
+  Eigen::Matrix<double, 3, 1> r_3rd_o = m_eph->getPosition(jd,
+                                                           EphemFrame::eci);
+  double r_3rd_o3 {r_3rd_o.norm()};
+  r_3rd_o3 *= r_3rd_o3*r_3rd_o3;
+
+  for (Eigen::Index ii=0; ii<states.cols(); ++ii) {
+    Eigen::Matrix<double, 3, 1> r_sat_3rd = states.block<3,1>(0,ii) - r_3rd_o;
+    double r_sat_3rd3 {r_sat_3rd.norm()};
+    r_sat_3rd3 *= r_sat_3rd3*r_sat_3rd3;
+    acc.col(ii) += -1.0*m_gm*(r_sat_3rd/r_sat_3rd3 + r_3rd_o/r_3rd_o3);
+  }
+}
+
+
 }
 
 #endif
@@ -13,6 +13,7 @@
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 #include <utl_const.h>
 #include <phy_const.h>
@@ -50,10 +51,22 @@ namespace eom {
  * resource using the "Standard" algorithm for the eom library.
  * The ephemeris resource is assumed to be a valid and bounded orbit.
  *
+ * The ephemeris type is a template parameter so the position lookups
+ * made with each step of the search and bisection loops are bound at
+ * compile time for concrete (final) ephemeris types.  Instantiations
+ * are provided for Ephemeris, accepting any ephemeris through the
+ * virtual interface, and each concrete type of EphemerisVariant - see
+ * resolve_ephemeris().
+ *
+ * @tparam  E  Ephemeris type
+ *
  * @author  Kurt Motekew
  * @date    20231027
  */
+template<typename E = Ephemeris>
 class GpAccessStd : public GpAccess {
+  static_assert(std::is_base_of_v<Ephemeris, E>,
+                "GpAccessStd requires an Ephemeris type");
 public:
   /**
    * Initialize but don't compute any access intervals
@@ -73,7 +86,7 @@ public:
               const JulianDate& jdStop,
               const GroundPoint& gp,
               const GpConstraints& xcs,
-              std::shared_ptr<const Ephemeris> eph);
+              std::shared_ptr<const E> eph);
   ~GpAccessStd() = default;
   GpAccessStd(const GpAccessStd&) = default;
   GpAccessStd& operator=(const GpAccessStd&) = default;
@@ -202,7 +215,7 @@ private:
   JulianDate m_jdStop;
   GroundPoint m_gp;
   GpConstraints m_xcs;
-  std::shared_ptr<const Ephemeris> m_eph;
+  std::shared_ptr<const E> m_eph;
 
   JulianDate m_jd;
   double m_dt_days_p {20.0*utl_const::day_per_sec};
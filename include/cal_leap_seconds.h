@@ -1,5 +1,5 @@
 /*
- * Copyright 2021 Kurt Motekew
+ * Copyright 2021, 2026 Kurt Motekew
  *
  * This Source Code Form is subject to the terms of the Mozilla Public
  * License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,67 +9,110 @@
 #ifndef CAL_LEAP_SECONDS_H
 #define CAL_LEAP_SECONDS_H
 
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include <cal_const.h>
 #include <cal_julian_date.h>
 
 namespace eom {
 
 /**
- * Singleton class containing a manually set leap second.  The default
- * number of leap seconds is set to zero.  The proper number should be
- * set at program startup.
+ * Table of TAI - UTC, the number of leap seconds, as a function of
+ * UTC.  The table is either a single manually set value applied to all
+ * times, or is loaded from an IERS leap second file.  Immutable once
+ * created so a single instance can be shared by any number of threads
+ * and scenarios.
+ *
+ * Lookups are a binary search of the table, preceded by a check of the
+ * entry located by the previous lookup.  Callers making many requests
+ * in sequence may instead supply their own hint, an index into the
+ * table, updated with each call.
  *
  * Example use:
- *   eom::LeapSeconds& ls = eom::LeapSeconds::getInstance();
- *   ls.setTai_Utc(100.0);
- *   std::cout << ls.getTai_Utc();
+ *   auto ls = std::make_shared<const eom::LeapSeconds>("Leap_Second.dat");
+ *   unsigned long hint {0UL};
+ *   for (const auto& utc : times) {
+ *     auto tt = ls->utc2tt(utc, hint);
+ *   }
  *
  * @author  Kurt Motekew
  * @date    202109  Initial
  */
-class LeapSeconds
-{
+class LeapSeconds {
 public:
-  LeapSeconds(LeapSeconds const&) = delete;
-  LeapSeconds(LeapSeconds const&&) = delete;
-  void operator=(LeapSeconds const&)  = delete;
-  void operator=(LeapSeconds const&&)  = delete;
+  ~LeapSeconds() = default;
+  LeapSeconds(const LeapSeconds&) = delete;
+  LeapSeconds& operator=(const LeapSeconds&) = delete;
+  LeapSeconds(LeapSeconds&&) = delete;
+  LeapSeconds& operator=(LeapSeconds&&) = delete;
 
   /**
-   * @return  The static reference to the leap second utility
+   * Initialize with a single value of TAI - UTC valid for all times.
+   *
+   * @param  tai_utc  TAI - UTC, seconds.  Defaults to 37.0, valid
+   *                  beginning 2017.
    */
-  static LeapSeconds& getInstance()
-  {
-    static LeapSeconds instance;
-    return instance;
-  }
+  explicit LeapSeconds(double tai_utc = 37.0);
 
   /**
-   * @param  dat  Set TAI - UTC, the number of leap seconds,
-   *              in seconds
+   * Load the table from an IERS leap second file (Leap_Second.dat).
+   * Lines starting with '#' are comments.  Each remaining line lists
+   * the MJD, day, month, year, and TAI - UTC in seconds beginning at
+   * that date.  Values prior to the first entry are set to the first
+   * entry.
+   *
+   * @param  fname  IERS leap second filename
+   *
+   * @throws  runtime_error if the file can't be opened, contains
+   *          invalid records, or holds no records.
    */
-  void setTai_Utc(double dat) noexcept
-  {
-    taimutc = dat;
-  }
+  explicit LeapSeconds(const std::string& fname);
+
+  /**
+   * @param  utc  UTC time
+   *
+   * @return  TAI - UTC, the number of leap seconds, seconds
+   */
+  double getTai_Utc(const JulianDate& utc) const noexcept;
+
+  /**
+   * @param  utc   UTC time
+   * @param  hint  Index of the table entry expected to be valid at utc,
+   *               typically the value set by a previous call.  Updated
+   *               to the index of the entry used.
+   *
+   * @return  TAI - UTC, the number of leap seconds, seconds
+   */
+  double getTai_Utc(const JulianDate& utc, unsigned long& hint) const noexcept;
 
   /**
-   * @return  TAI - UTC, the number of LeapSecondss, seconds
+   * Convert UTC to TT
+   *
+   * @param  utc  UTC time
+   *
+   * @return  TT time
    */
-  double getTai_Utc() const noexcept
+  JulianDate utc2tt(const JulianDate& utc) const noexcept
   {
-    return taimutc;
+    return utc + (this->getTai_Utc(utc) + cal_const::ttmtai)*
+                 cal_const::day_per_sec;
   }
 
   /**
    * Convert UTC to TT
    *
-   * @param  utc  UTC time
+   * @param  utc   UTC time
+   * @param  hint  Table index hint, see getTai_Utc()
    *
    * @return  TT time
    */
-  JulianDate utc2tt(const JulianDate& utc) const noexcept {
-    return utc + (taimutc + cal_const::ttmtai)*cal_const::day_per_sec;
+  JulianDate utc2tt(const JulianDate& utc, unsigned long& hint) const noexcept
+  {
+    return utc + (this->getTai_Utc(utc, hint) + cal_const::ttmtai)*
+                 cal_const::day_per_sec;
   }
 
   /**
@@ -79,16 +122,47 @@ public:
    *
    * @return  UTC time
    */
-  JulianDate tt2utc(const JulianDate& tt) const noexcept {
-    return tt + -1.0*(taimutc + cal_const::ttmtai)*cal_const::day_per_sec;
+  JulianDate tt2utc(const JulianDate& tt) const noexcept;
+
+  /**
+   * Convert TT to UTC.  UTC is not uniquely defined during an inserted
+   * leap second.
+   *
+   * @param  tt    TT time
+   * @param  hint  Table index hint, see getTai_Utc()
+   *
+   * @return  UTC time
+   */
+  JulianDate tt2utc(const JulianDate& tt, unsigned long& hint) const noexcept;
+
+  /**
+   * @return  Number of entries in the table
+   */
+  unsigned long size() const noexcept
+  {
+    return static_cast<unsigned long>(m_mjd2000.size());
+  }
+
+  /**
+   * @return  Hash of the table contents, suitable for identifying
+   *          tables producing identical time conversions.
+   */
+  std::uint64_t getHash() const noexcept
+  {
+    return m_hash;
   }
 
 private:
-    // Disallow construction
-  LeapSeconds() {}
+    // Index of the entry valid at mjd2000, checking hint first
+  unsigned long locate(double mjd2000, unsigned long hint) const noexcept;
+    // Compute m_hash from table contents
+  void setHash() noexcept;
 
-    // TAI - UTC, seconds
-  double taimutc {37.0};
+  std::vector<double> m_mjd2000;        // UTC start of each entry
+  std::vector<double> m_tai_utc;        // TAI - UTC, seconds
+  std::uint64_t m_hash {0};
+    // Index located by the most recent lookup without a hint
+  mutable std::atomic<unsigned long> m_last {0UL};
 };
 
 
@@ -10,6 +10,8 @@
 #define EOM_CONFIG_H
 
 #include <deque>
+#include <map>
+#include <memory>
 #include <ostream>
 #include <set>
 #include <string>
@@ -17,6 +19,7 @@
 
 #include <cal_duration.h>
 #include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
 
 namespace eom_app {
 
@@ -60,13 +63,26 @@ public:
 
   /**
    * @param  tokens  Tokenized parameters indicating the number of assumed leap
-   *                 seconds
+   *                 seconds, or the name of an IERS leap second file
    */
   void setLeapSeconds(std::deque<std::string>& tokens);
 
+  /**
+   * @return  TAI - UTC table, 37 seconds for all times if not set
+   */
+  std::shared_ptr<const eom::LeapSeconds> getLeapSeconds() const noexcept
+  {
+    return m_leap_seconds;
+  }
+
   /**
    * @param  tokens  Tokenized parameters representing the time update rate
-   *                 that will be used when storing reduction parameters
+   *                 that will be used when storing reduction parameters,
+   *                 optionally followed by "Lazy" to generate reduction
+   *                 parameters only as needed, and/or "Chebyshev" to
+   *                 select Chebyshev interpolation of reduction parameters
+   *                 (fewer stored parameters for the same accuracy, at a
+   *                 higher cost per lookup)
    */
   void setEcfEciRate(std::deque<std::string>& tokens);
 
@@ -75,6 +91,30 @@ public:
    */
   eom::Duration getEcfEciRate() const noexcept { return dtEcfEci; }
 
+  /**
+   * @return  If true, reduction parameters are generated as needed vs.
+   *          all at once during initialization
+   */
+  bool getEcfEciLazy() const noexcept { return f2i_lazy; }
+
+  /**
+   * @return  If true, Chebyshev interpolation of reduction parameters
+   *          is used vs. linear interpolation
+   */
+  bool getEcfEciChebyshev() const noexcept { return f2i_chebyshev; }
+
+  /**
+   * @param  tokens  Tokenized parameters indicating the directory in
+   *                 which to cache reduction parameters
+   */
+  void setEcfEciCache(std::deque<std::string>& tokens);
+
+  /**
+   * @return  Directory in which to cache reduction parameters.  Empty
+   *          if not caching.
+   */
+  std::string getEcfEciCache() const noexcept { return f2i_cache_dir; }
+
   /**
    * @param  tokens  Label used to determine and set the conversion
    *                 factor from input/output units to internal angle
@@ -165,6 +205,22 @@ public:
    */
   std::vector<std::string> getCelestials() const;
 
+  /**
+   * @param  tokens  Tokenized parameters with the name of an ephemeris
+   *                 to be cached, optionally followed by "Slots" and
+   *                 the number of cache entries.  See CachedEphemeris.
+   */
+  void addEphemerisCache(std::deque<std::string>& tokens);
+
+  /**
+   * @return  Names of ephemerides to cache and the number of cache
+   *          entries for each
+   */
+  std::map<std::string, unsigned long> getEphemerisCaches() const
+  {
+    return m_eph_caches;
+  }
+
   /**
    * @return  If an error was encountered while building the scenario,
    *          the return value is false.  Call getError().
@@ -187,7 +243,13 @@ private:
   bool valid {true};
   bool epoch_set {false};
   bool f2i_rate_set {false};
+  bool f2i_lazy {false};
+  bool f2i_chebyshev {false};
+  std::string f2i_cache_dir {""};
   bool leapsec_set {false};
+  std::shared_ptr<const eom::LeapSeconds> m_leap_seconds {
+    std::make_shared<const eom::LeapSeconds>()
+  };
   std::string error_string {""};
   eom::JulianDate jdStart;
   eom::JulianDate jdStop;
@@ -196,6 +258,7 @@ private:
 
   std::set<std::string> m_orbit_names;
   std::vector<std::string> m_celestial_names;
+  std::map<std::string, unsigned long> m_eph_caches;
   
 };
 
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef EOM_EPHEM_WRITER_H
+#define EOM_EPHEM_WRITER_H
+
+#include <memory>
+#include <string>
+#include <deque>
+#include <unordered_map>
+
+#include <astro_ephemeris.h>
+#include <astro_sp_ephemeris.h>
+
+#include <eom_command.h>
+#include <eom_config.h>
+
+namespace eom_app {
+
+/**
+ * EOM Command type that writes the interpolation polynomials of a
+ * numerically integrated orbit to an EOM binary ephemeris file.  The
+ * file may be loaded by later runs with an EphemerisFile EomBinary
+ * definition, avoiding repeated integration.
+ */
+class EomEphemWriter : public EomCommand {
+public:
+  ~EomEphemWriter() = default;
+  EomEphemWriter(const EomEphemWriter&) = default;
+  EomEphemWriter& operator=(const EomEphemWriter&) = default;
+  EomEphemWriter(EomEphemWriter&&) = default;
+  EomEphemWriter& operator=(EomEphemWriter&&) = default;
+
+  /**
+   * Converts string tokens into an ephemeris write command.
+   *
+   * @param  tokens      Tokenized parameters with the orbit name and
+   *                     output filename.  Tokens are consumed as they
+   *                     are used.
+   * @param  cfg         Scenario configuration
+   *
+   * @throws  invalid_argument if exactly 2 tokens are not present or
+   *          the orbit name is unknown.
+   */
+  EomEphemWriter(std::deque<std::string>& tokens, const EomConfig& cfg);
+
+  /**
+   * Checks that input ephemeris source is valid
+   *
+   * @param  ephemerides  All  available ephemeris resources
+   *
+   * @throws  CmdValidateException if the orbit name is not valid or
+   *          the orbit is not a numerically integrated (SP) orbit.
+   */
+  void validate(const std::unordered_map<
+      std::string, std::shared_ptr<eom::Ephemeris>>& ephemerides) override;
+
+  /**
+   * Writes binary ephemeris to the previously specified file.
+   */
+  void execute() const override;
+
+private:
+  std::string m_orbit_name;
+  std::string m_file_name;
+  std::shared_ptr<eom::SpEphemeris> m_eph;
+};
+
+
+}
+
+#endif
@@ -17,6 +17,7 @@
 
 #include <cal_duration.h>
 #include <cal_julian_date.h>
+#include <astro_dispersion_def.h>
 #include <astro_ephemeris_file.h>
 #include <astro_ground_point.h>
 #include <astro_orbit_def.h>
@@ -95,6 +96,25 @@ eom::OrbitDef parse_orbit_def(std::deque<std::string>& tokens,
 eom::RelOrbitDef parse_rel_orbit_def(std::deque<std::string>& tokens,
                                      const EomConfig& cfg);
 
+/**
+ * Parses a Monte Carlo dispersion of an orbit definition.  The
+ * covariance is given either as 6 standard deviations ("Sigma") or as
+ * the 21 upper triangular elements, row by row ("Covariance"), of the
+ * Cartesian GCRF state in input distance and time units.
+ *
+ * @param  tokens  Tokens consisting of a dispersion name, template
+ *                 orbit, number of samples, seed, covariance type and
+ *                 values, and output filename.
+ * @param  cfg     Scenario configuration parameters
+ *
+ * @return  A dispersion definition
+ *
+ * @throws  An invalid_argument exception if parsing fails.  No error is
+ *          thrown if the list of tokens is not empty upon completion.
+ */
+eom::DispersionDef parse_dispersion_def(std::deque<std::string>& tokens,
+                                        const EomConfig& cfg);
+
 /**
  * Parses an ephemeris file definition (not the ephemeris file).
  *
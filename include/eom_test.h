@@ -47,6 +47,82 @@ void eom_test_sun();
  */
 void eom_test_moon();
 
+/**
+ * Compares packed Hermite2Table evaluation to the Hermite2
+ * polynomials the table was formed from
+ */
+void eom_test_hermite2_table();
+
+/**
+ * Checks Hermite2Table evaluation with single precision derivative
+ * coefficients against its storage error bounds
+ */
+void eom_test_hermite2_table_compact();
+
+/**
+ * Writes SP ephemerides in the EOM binary format, compares the mapped
+ * files to the source ephemerides, and checks that malformed files
+ * are rejected
+ */
+void eom_test_ephemeris_binary();
+
+/**
+ * Checks CachedEphemeris hit and miss accounting and compares cached
+ * results, including those from many threads sharing a small cache,
+ * to the wrapped ephemeris
+ */
+void eom_test_ephemeris_cache();
+
+/**
+ * Compares lazily generated SP ephemeris, with and without a segment
+ * limit, to ephemeris generated upon construction, including
+ * concurrent requests and writing after segments have been released
+ */
+void eom_test_sp_lazy();
+
+/**
+ * Compares two-body SP ephemeris generated with the RKF7(8) integrator
+ * to the Kepler propagator
+ */
+void eom_test_rkf78();
+
+/**
+ * Compares two-body SP ephemeris generated with the variable step,
+ * variable order Adams integrator to the Kepler propagator
+ */
+void eom_test_adams();
+
+/**
+ * Compares two-body SP ephemeris generated with the summed form 8th
+ * order Gauss-Jackson integrator to the Kepler propagator
+ */
+void eom_test_gj8();
+
+/**
+ * Compares orbits propagated as an ensemble to the same orbits
+ * propagated individually
+ */
+void eom_test_ensemble();
+
+/**
+ * Compares running dispersion statistics to two pass statistics, and
+ * sampled initial states to the input covariance
+ */
+void eom_test_dispersion();
+
+/**
+ * Compares Chebyshev interpolated ECF to ECI transformations to
+ * linear interpolation at a much higher rate, and UT1 - UTC across a
+ * leap second to the source EOP data
+ */
+void eom_test_ecfeci_chebyshev();
+
+/**
+ * Checks that ECF/ECI services no longer in use don't widen new
+ * services, and that services still held are merged and shared
+ */
+void eom_test_ecfeci_registry();
+
 
 }
 
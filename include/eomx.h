@@ -18,8 +18,11 @@
 #include <cal_julian_date.h>
 #include <astro_orbit_def.h>
 #include <astro_rel_orbit_def.h>
+#include <astro_dispersion_def.h>
 #include <astro_ephemeris_file.h>
+#include <astro_ecfeci_registry.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ephemeris.h>
 #include <astro_ground_point.h>
 #include <axs_gp_access_def.h>
 #include <axs_gp_access.h>
@@ -27,6 +30,20 @@
 #include <eom_config.h>
 #include <eom_command.h>
 
+/**
+ * Runs the scenario defined by an eomx input file:  parses the file,
+ * generates models, and executes commands.
+ *
+ * @param  fname        Name of input file defining the scenario
+ * @param  f2iRegistry  Source of ECF/ECI services, possibly shared
+ *                      with other scenarios
+ *
+ * @return  Zero on success, nonzero if the scenario could not be
+ *          completed
+ */
+int eomx_run_scenario(const std::string& fname,
+                      eom::EcfEciRegistry& f2iRegistry);
+
 /**
  * Parses an eomx input file.  All arguments except fname are modified.
  * Generates the simulation configuration parameters along with modeling
@@ -37,6 +54,7 @@
  * @param  cfg             Scenario configuration
  * @param  orbit_defs      Orbit definitions based on an initial state
  * @param  rel_orbit_defs  Orbit definitions based on another orbit
+ * @param  dispersion_defs Monte Carlo dispersions of orbit definitions
  * @param  eph_file_defs   Ephemeris file definition
  * @param  ground_points   Ground points
  * @param  gp_access_defs  Access definition to a ground point
@@ -48,6 +66,7 @@ void eomx_parse_input_file(const std::string& fname,
                            eom_app::EomConfig& cfg,
                            std::vector<eom::OrbitDef>& orbit_defs,
                            std::vector<eom::RelOrbitDef>& rel_orbit_defs,
+                           std::vector<eom::DispersionDef>& dispersion_defs,
                            std::vector<eom::EphemerisFile>& eph_file_defs,
                            std::unordered_map<std::string,std::shared_ptr<
                                               eom::GroundPoint>>& ground_points,
@@ -83,15 +102,47 @@ eomx_simulation_time(const eom_app::EomConfig& cfg,
  * @param  eph_file_defs   Ephemeris file definition
  * @param  f2iSys          ECF/ECI transformation service that will be
  *                         copied into each ephemeris type created.
+ * @param  celestials      Celestial ephemerides, by name
+ *
+ * @return  Map of ephemerides indexed by orbit name.  Ephemerides
+ *          listed by EomConfig::getEphemerisCaches() are wrapped in a
+ *          CachedEphemeris.
  *
- * @return  Map of ephemerides indexed by orbit name
+ * @throws  eom_app::EomXException if an ephemeris to be cached does
+ *          not exist
  */
 std::unordered_map<std::string,std::shared_ptr<eom::Ephemeris>>
 eomx_gen_ephemerides(const eom_app::EomConfig& cfg,
                      const std::vector<eom::OrbitDef>& orbit_defs,
                      const std::vector<eom::RelOrbitDef>& rel_orbit_defs,
                      const std::vector<eom::EphemerisFile>& eph_file_defs,
-                     const std::shared_ptr<eom::EcfEciSys>& f2iSys);
+                     const std::shared_ptr<const eom::EcfEciSys>& f2iSys,
+                     const std::unordered_map<std::string,
+                             std::vector<eom::state_vector_rec>>& celestials);
+
+/**
+ * Generate Monte Carlo dispersion statistics, writing each to the file
+ * named by its definition.  Sampled orbits share the ECF/ECI service
+ * and celestial ephemerides and are not retained.
+ *
+ * @param  cfg              Scenario configuration.  Statistics span the
+ *                          simulation time at the output rate.
+ * @param  orbit_defs       Orbit definitions based on an initial state
+ * @param  dispersion_defs  Dispersions of orbit_defs
+ * @param  f2iSys           ECF/ECI transformation service shared by
+ *                          all sampled orbits
+ * @param  celestials       Celestial ephemerides, by name
+ *
+ * @throws  eom_app::EomXException if a template orbit does not exist
+ *          or can't be dispersed
+ */
+void eomx_gen_dispersions(
+    const eom_app::EomConfig& cfg,
+    const std::vector<eom::OrbitDef>& orbit_defs,
+    const std::vector<eom::DispersionDef>& dispersion_defs,
+    const std::shared_ptr<const eom::EcfEciSys>& f2iSys,
+    const std::unordered_map<std::string,
+                             std::vector<eom::state_vector_rec>>& celestials);
 
 /**
  * Given access analysis definitions, assign resources and run analysis.
@@ -116,6 +167,6 @@ eomx_gen_gp_accesses(
     const std::unordered_map<std::string,
                              std::shared_ptr<eom::Ephemeris>>& ephemerides,
     const std::vector<eom::GpAccessDef>& gp_access_defs,
-    const std::shared_ptr<eom::EcfEciSys>& f2iSys);
+    const std::shared_ptr<const eom::EcfEciSys>& f2iSys);
 
 #endif
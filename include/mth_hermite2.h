@@ -73,7 +73,7 @@ public:
    * @return  Maximum allowable time, measured from zero, that may be
    *          used with this interpolator
    */
-  T getMaxDt()
+  T getMaxDt() const
   {
     return m_dt_max;
   }
@@ -122,6 +122,18 @@ public:
    */
   Eigen::Matrix<T, N, 1> getAcceleration(T dt) const;
 
+  /**
+   * @return  Polynomial coefficients as columns, in order:  position,
+   *          velocity, acceleration, jerk, jitter, and dither.  The
+   *          k'th column is the k'th derivative at zero.
+   */
+  Eigen::Matrix<T, N, 6> getCoefficients() const
+  {
+    Eigen::Matrix<T, N, 6> coeffs;
+    coeffs << m_p0, m_v0, m_a0, m_j0, m_k0, m_l0;
+    return coeffs;
+  }
+
 private:
   T m_dt_min {0};
   T m_dt_max {};
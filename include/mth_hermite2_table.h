@@ -0,0 +1,289 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef MTH_HERMITE2_TABLE_H
+#define MTH_HERMITE2_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <mth_hermite2.h>
+
+namespace eom {
+
+/**
+ * Packed storage of a sequence of Hermite2 polynomials, as formed for
+ * piecewise interpolation.  Only polynomial coefficients are retained -
+ * interval bounds are maintained by the caller, typically as a single
+ * contiguous list of node times shared by all tables covering the same
+ * intervals.
+ *
+ * Coefficients for each polynomial are stored coefficient major, with
+ * vector components padded to a multiple of four so each coefficient
+ * fills whole SIMD registers (one 256-bit AVX register for N = 3).
+ * With full precision storage, each polynomial occupies a cache line
+ * aligned block, three lines for N = 3, so evaluation streams through
+ * whole lines and components are evaluated together.  Evaluation is
+ * identical to Hermite2, other than the lack of bounds checking.
+ *
+ * The derivative coefficients may be stored at reduced precision
+ * (e.g., float) while the position coefficient, the anchor of each
+ * polynomial, retains full precision.  Evaluation is always performed
+ * with type T.  The rounding error introduced by storage is bounded as
+ * each polynomial is added by summing, over the derivative
+ * coefficients, the coefficient rounding error times the magnitude of
+ * the term it multiplies at the end of the interval.  The largest
+ * bound over all polynomials is available for validation against a
+ * required tolerance.  For N = 3 and C = float, storage is reduced
+ * from 192 to 112 bytes per polynomial.
+ *
+ * Polynomial blocks may be written as raw bytes via data() and later
+ * evaluated in place, e.g., from a memory mapped file, through a table
+ * viewing external storage.
+ *
+ * @tparam  T  Vector component data type
+ * @tparam  N  Dimension of interpolated vectors
+ * @tparam  C  Storage type for derivative coefficients
+ */
+template<typename T, int N, typename C = T>
+class Hermite2Table {
+public:
+  /**
+   * Initialize an empty table owning its storage
+   */
+  Hermite2Table() = default;
+
+  /**
+   * Initialize as a read only view of n polynomial blocks previously
+   * written from data() by a table of the same type.  The storage must
+   * remain valid for the lifetime of this table (and any copies).  If
+   * the storage is not aligned to blockAlignment(), the blocks are
+   * copied instead.  Polynomials must not be appended to a view.
+   *
+   * @param  storage  Start of polynomial blocks
+   * @param  n        Number of polynomials
+   */
+  Hermite2Table(const void* storage, unsigned long n);
+
+  /**
+   * @return  Size of the storage for each polynomial, bytes
+   */
+  static constexpr std::size_t blockSize() noexcept
+  {
+    return sizeof(block);
+  }
+
+  /**
+   * @return  Required alignment of polynomial storage, bytes
+   */
+  static constexpr std::size_t blockAlignment() noexcept
+  {
+    return alignof(block);
+  }
+
+  /**
+   * @return  Start of size()*blockSize() bytes of polynomial storage
+   */
+  const void* data() const noexcept
+  {
+    return this->blocks();
+  }
+
+  /**
+   * @param  n  Number of polynomials to reserve storage for
+   */
+  void reserve(unsigned long n)
+  {
+    m_blocks.reserve(n);
+  }
+
+  /**
+   * Append the polynomial from a Hermite2 interpolator
+   *
+   * @param  hItp  Interpolator to copy coefficients from
+   */
+  void push_back(const Hermite2<T, N>& hItp);
+
+  /**
+   * @return  Number of polynomials stored
+   */
+  unsigned long size() const noexcept
+  {
+    if (m_view != nullptr) {
+      return m_nview;
+    }
+    return static_cast<unsigned long>(m_blocks.size());
+  }
+
+  /**
+   * @return  true if no polynomials are stored
+   */
+  bool empty() const noexcept
+  {
+    return this->size() == 0UL;
+  }
+
+  /**
+   * @param  ndx  Index of polynomial to evaluate, < size()
+   * @param  dt   Time from the start of the polynomial interval
+   *
+   * @return  The interpolated position
+   */
+  Eigen::Matrix<T, N, 1> getPosition(unsigned long ndx, T dt) const;
+
+  /**
+   * @param  ndx  Index of polynomial to evaluate, < size()
+   * @param  dt   Time from the start of the polynomial interval
+   *
+   * @return  The interpolated velocity
+   */
+  Eigen::Matrix<T, N, 1> getVelocity(unsigned long ndx, T dt) const;
+
+  /**
+   * @return  Bound on the largest position component error due to
+   *          reduced precision storage over all polynomials.  Zero if
+   *          C is the same as T.
+   */
+  T getMaxPositionError() const noexcept
+  {
+    return m_max_pos_err;
+  }
+
+  /**
+   * @return  Bound on the largest velocity component error due to
+   *          reduced precision storage over all polynomials.  Zero if
+   *          C is the same as T.
+   */
+  T getMaxVelocityError() const noexcept
+  {
+    return m_max_vel_err;
+  }
+
+private:
+    // Components padded to fill whole SIMD registers
+  static constexpr int L {(N + 3)/4*4};
+  using lanes = Eigen::Matrix<T, L, 1>;
+  using clanes = Eigen::Matrix<C, L, 1>;
+  static constexpr std::size_t bytes {L*sizeof(T) + 5*L*sizeof(C)};
+
+    // Position anchor followed by velocity through dither coefficients.
+    // Cache line aligned if the block fills whole lines.
+  struct alignas(bytes%64 == 0 ? 64 : 16) block {
+    lanes p0;
+    std::array<clanes, 5> c;
+  };
+
+    // Owned or viewed storage
+  const block* blocks() const noexcept
+  {
+    return (m_view != nullptr) ? m_view : m_blocks.data();
+  }
+
+  std::vector<block> m_blocks;
+  const block* m_view {nullptr};
+  unsigned long m_nview {0UL};
+  T m_max_pos_err {0};
+  T m_max_vel_err {0};
+};
+
+
+template<typename T, int N, typename C>
+Hermite2Table<T, N, C>::Hermite2Table(const void* storage, unsigned long n)
+{
+  if (reinterpret_cast<std::uintptr_t>(storage)%alignof(block) == 0) {
+    m_view = static_cast<const block*>(storage);
+    m_nview = n;
+  } else {
+    m_blocks.resize(n);
+    std::memcpy(static_cast<void*>(m_blocks.data()), storage,
+                n*sizeof(block));
+  }
+}
+
+
+template<typename T, int N, typename C>
+void Hermite2Table<T, N, C>::push_back(const Hermite2<T, N>& hItp)
+{
+  Eigen::Matrix<T, N, 6> coeffs {hItp.getCoefficients()};
+  block& blk = m_blocks.emplace_back();
+  blk.p0.setZero();
+  blk.p0.template head<N>() = coeffs.col(0);
+  for (int ii=0; ii<5; ++ii) {
+    blk.c[ii].setZero();
+    blk.c[ii].template head<N>() = coeffs.col(ii+1).template cast<C>();
+  }
+
+    // Storage error bound:  sum of |dc_k| h^k/k! for position and
+    // |dc_k| h^(k-1)/(k-1)! for velocity
+  T h {std::abs(hItp.getMaxDt())};
+  Eigen::Matrix<T, N, 1> pos_err = Eigen::Matrix<T, N, 1>::Zero();
+  Eigen::Matrix<T, N, 1> vel_err = Eigen::Matrix<T, N, 1>::Zero();
+  T pos_scale {1};
+  T vel_scale {1};
+  for (int ii=0; ii<5; ++ii) {
+    pos_scale *= h/static_cast<T>(ii + 1);
+    if (ii > 0) {
+      vel_scale *= h/static_cast<T>(ii);
+    }
+    Eigen::Matrix<T, N, 1> dc = (coeffs.col(ii+1) -
+        blk.c[ii].template head<N>().template cast<T>()).cwiseAbs();
+    pos_err += pos_scale*dc;
+    vel_err += vel_scale*dc;
+  }
+  m_max_pos_err = std::max(m_max_pos_err, pos_err.maxCoeff());
+  m_max_vel_err = std::max(m_max_vel_err, vel_err.maxCoeff());
+}
+
+
+template<typename T, int N, typename C>
+Eigen::Matrix<T, N, 1> Hermite2Table<T, N, C>::getPosition(unsigned long ndx,
+                                                          T dt) const
+{
+  constexpr T tf2 {static_cast<T>(1.0)/(static_cast<T>(2.0))};
+  constexpr T tf3 {static_cast<T>(1.0)/(static_cast<T>(3.0))};
+  constexpr T tf4 {static_cast<T>(1.0)/(static_cast<T>(4.0))};
+  constexpr T tf5 {static_cast<T>(1.0)/(static_cast<T>(5.0))};
+
+  const block& blk = this->blocks()[ndx];
+  const std::array<clanes, 5>& c = blk.c;
+  lanes pos = blk.p0 +   dt*(c[0].template cast<T>() +
+                     tf2*dt*(c[1].template cast<T>() +
+                     tf3*dt*(c[2].template cast<T>() +
+                     tf4*dt*(c[3].template cast<T>() +
+                     tf5*dt*(c[4].template cast<T>())))));
+  return pos.template head<N>();
+}
+
+
+template<typename T, int N, typename C>
+Eigen::Matrix<T, N, 1> Hermite2Table<T, N, C>::getVelocity(unsigned long ndx,
+                                                          T dt) const
+{
+  constexpr T tf2 {static_cast<T>(1.0)/(static_cast<T>(2.0))};
+  constexpr T tf3 {static_cast<T>(1.0)/(static_cast<T>(3.0))};
+  constexpr T tf4 {static_cast<T>(1.0)/(static_cast<T>(4.0))};
+
+  const std::array<clanes, 5>& c = this->blocks()[ndx].c;
+  lanes vel = c[0].template cast<T>() +     dt*(c[1].template cast<T>() +
+                                        tf2*dt*(c[2].template cast<T>() +
+                                        tf3*dt*(c[3].template cast<T>() +
+                                        tf4*dt*(c[4].template cast<T>()))));
+  return vel.template head<N>();
+}
+
+
+}
+
+#endif
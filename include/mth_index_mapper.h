@@ -62,6 +62,21 @@ public:
    */
   unsigned long getIndex(const T& val) const;
 
+  /**
+   * Same as getIndex(val), but first checks the interval at hint and the
+   * one following.  Sequential requests in increasing order can pass
+   * the previously returned index to avoid the search.
+   *
+   * @param  Value for which a the index to the interval containing that
+   *         value is to be found.
+   * @param  hint  Index of the interval expected to contain val
+   *
+   * @return  The index of the interval containing the input value.
+   *
+   * @throws  out_of_range if value is not covered
+   */
+  unsigned long getIndex(const T& val, unsigned long hint) const;
+
 private:
   double m_bsize {};              // Maximum block size
   double m_range {};              // Size of all intervals
@@ -158,6 +173,19 @@ unsigned long IndexMapper<T>::getIndex(const T& val) const
 }
 
 
+template<typename T>
+unsigned long IndexMapper<T>::getIndex(const T& val, unsigned long hint) const
+{
+  for (unsigned long ndx=hint; ndx<m_blocks.size()  &&  ndx<=hint+1UL; ++ndx) {
+    if (m_blocks[ndx].first <= val  &&  val <= m_blocks[ndx].second) {
+      return ndx;
+    }
+  }
+
+  return this->getIndex(val);
+}
+
+
 }
 
 #endif
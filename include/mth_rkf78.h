@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef MTH_RKF78_H
+#define MTH_RKF78_H
+
+#include <array>
+
+#include <Eigen/Dense>
+
+#include <mth_ode.h>
+
+namespace eom {
+
+/**
+ * Runge-Kutta-Fehlberg 7(8) Butcher tableau, Erwin Fehlberg, "Classical
+ * Fifth-, Sixth-, Seventh-, and Eighth-Order Runge-Kutta Formulas with
+ * Stepsize Control", NASA TR R-287, 1968.  Thirteen stages yield
+ * embedded 7th and 8th order solutions.
+ */
+namespace rkf78 {
+  constexpr int stages {13};
+  constexpr std::array<double, stages> c {
+    0.0, 2.0/27.0, 1.0/9.0, 1.0/6.0, 5.0/12.0, 1.0/2.0, 5.0/6.0,
+    1.0/6.0, 2.0/3.0, 1.0/3.0, 1.0, 0.0, 1.0
+  };
+  constexpr std::array<std::array<double, stages>, stages> a {{
+    {},
+    {2.0/27.0},
+    {1.0/36.0, 1.0/12.0},
+    {1.0/24.0, 0.0, 1.0/8.0},
+    {5.0/12.0, 0.0, -25.0/16.0, 25.0/16.0},
+    {1.0/20.0, 0.0, 0.0, 1.0/4.0, 1.0/5.0},
+    {-25.0/108.0, 0.0, 0.0, 125.0/108.0, -65.0/27.0, 125.0/54.0},
+    {31.0/300.0, 0.0, 0.0, 0.0, 61.0/225.0, -2.0/9.0, 13.0/900.0},
+    {2.0, 0.0, 0.0, -53.0/6.0, 704.0/45.0, -107.0/9.0, 67.0/90.0, 3.0},
+    {-91.0/108.0, 0.0, 0.0, 23.0/108.0, -976.0/135.0, 311.0/54.0,
+     -19.0/60.0, 17.0/6.0, -1.0/12.0},
+    {2383.0/4100.0, 0.0, 0.0, -341.0/164.0, 4496.0/1025.0, -301.0/82.0,
+     2133.0/4100.0, 45.0/82.0, 45.0/164.0, 18.0/41.0},
+    {3.0/205.0, 0.0, 0.0, 0.0, 0.0, -6.0/41.0, -3.0/205.0, -3.0/41.0,
+     3.0/41.0, 6.0/41.0, 0.0},
+    {-1777.0/4100.0, 0.0, 0.0, -341.0/164.0, 4496.0/1025.0, -289.0/82.0,
+     2193.0/4100.0, 51.0/82.0, 33.0/164.0, 12.0/41.0, 0.0, 1.0}
+  }};
+    // 8th order weights
+  constexpr std::array<double, stages> b {
+    0.0, 0.0, 0.0, 0.0, 0.0, 34.0/105.0, 9.0/35.0, 9.0/35.0,
+    9.0/280.0, 9.0/280.0, 0.0, 41.0/840.0, 41.0/840.0
+  };
+    // 8th - 7th order solution = e*(k1 + k11 - k12 - k13)
+  constexpr double e {41.0/840.0};
+}
+
+
+/**
+ * Performs a single Runge-Kutta-Fehlberg 7(8) step, returning the 8th
+ * order solution (local extrapolation) and an estimate of its local
+ * truncation error, the difference from the embedded 7th order
+ * solution.  Step size control is left to the caller.
+ *
+ * @tparam  T    Time type
+ * @tparam  DT   Duration compatible with T type and time units (TU)
+ * @tparam  F    Data type of state vector
+ * @tparam  DIM  State vector dimension
+ *
+ * @param  deq   Equations of motion
+ * @param  dt    Integration step size.  May be negative.
+ * @param  time  State vector epoch
+ * @param  x     State vector at epoch
+ * @param  dx    Derivative of state vector at epoch
+ * @param  xout  Output propagated state vector at time + dt
+ * @param  xerr  Output local truncation error estimate
+ */
+template<typename T, typename DT, typename F, int DIM>
+void rkf78_step(Ode<T, F, DIM>* deq,
+                const DT& dt,
+                const T& time,
+                const Eigen::Matrix<F, DIM, 1>& x,
+                const Eigen::Matrix<F, DIM, 1>& dx,
+                Eigen::Matrix<F, DIM, 1>& xout,
+                Eigen::Matrix<F, DIM, 1>& xerr)
+{
+  auto dt_tu = dt.getTu();
+  std::array<Eigen::Matrix<F, DIM, 1>, rkf78::stages> k;
+  k[0] = dx;
+  for (int ii=1; ii<rkf78::stages; ++ii) {
+    Eigen::Matrix<F, DIM, 1> xs = x;
+    for (int jj=0; jj<ii; ++jj) {
+      if (rkf78::a[ii][jj] != 0.0) {
+        xs += (dt_tu*static_cast<F>(rkf78::a[ii][jj]))*k[jj];
+      }
+    }
+    k[ii] = deq->getXdot(time + dt*rkf78::c[ii], xs);
+  }
+
+  xout = x;
+  for (int ii=0; ii<rkf78::stages; ++ii) {
+    if (rkf78::b[ii] != 0.0) {
+      xout += (dt_tu*static_cast<F>(rkf78::b[ii]))*k[ii];
+    }
+  }
+  xerr = (dt_tu*static_cast<F>(rkf78::e))*(k[0] + k[10] - k[11] - k[12]);
+}
+
+}
+
+#endif
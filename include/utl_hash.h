@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UTL_HASH_H
+#define UTL_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eom {
+
+namespace fnv1a {
+
+constexpr std::uint64_t offset {14695981039346656037ULL};
+constexpr std::uint64_t prime {1099511628211ULL};
+
+/**
+ * Accumulate a 64 bit FNV-1a hash of a block of bytes.  Not suitable
+ * for cryptographic purposes - used to detect changes in data.
+ *
+ * @param  hash  Hash to update, initialize with fnv1a::offset
+ * @param  data  Pointer to the first byte to hash
+ * @param  n     Number of bytes to hash
+ */
+inline void hash(std::uint64_t& hash, const void* data, std::size_t n)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t ii=0; ii<n; ++ii) {
+    hash ^= bytes[ii];
+    hash *= prime;
+  }
+}
+
+
+}
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UTL_MAPPED_FILE_H
+#define UTL_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace eom {
+
+/**
+ * Read only view of the contents of a file.  On POSIX systems the file
+ * is memory mapped, otherwise the contents are read into memory.  The
+ * view remains valid for the lifetime of this object.
+ */
+class MappedFile {
+public:
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  /**
+   * Open and map the given file.
+   *
+   * @param  fname  Name of file to open
+   *
+   * @throws  runtime_error if the file can't be opened or mapped
+   */
+  MappedFile(const std::string& fname);
+
+  /**
+   * @return  Pointer to the first byte of the file contents
+   */
+  const char* data() const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @return  Size of the file, bytes
+   */
+  std::size_t size() const noexcept
+  {
+    return m_size;
+  }
+
+private:
+  const char* m_data {nullptr};
+  std::size_t m_size {0};
+  bool m_mapped {false};
+  std::vector<char> m_buffer;
+};
+
+
+}
+
+#endif
@@ -0,0 +1,368 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_adams_vsvo.h>
+
+#include <utility>
+#include <memory>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <mth_ode.h>
+
+namespace {
+    // Maximum order
+  constexpr int kmax {12};
+    // Powers of two and error estimate coefficients, 1 based
+  constexpr std::array<double, 14> two {
+    0.0, 2.0, 4.0, 8.0, 16.0, 32.0, 64.0, 128.0, 256.0, 512.0, 1024.0,
+    2048.0, 4096.0, 8192.0
+  };
+  constexpr std::array<double, 14> gstr {
+    0.0, 0.500, 0.0833, 0.0417, 0.0264, 0.0188, 0.0143, 0.0114,
+    0.00936, 0.00789, 0.00679, 0.00592, 0.00524, 0.00468
+  };
+  constexpr double twou {2.0*std::numeric_limits<double>::epsilon()};
+  constexpr double fouru {4.0*std::numeric_limits<double>::epsilon()};
+}
+
+namespace eom {
+
+
+AdamsVsvo::AdamsVsvo(std::unique_ptr<Ode<JulianDate, double, 6>> deq,
+                     const Duration& dt,
+                     const JulianDate& jd,
+                     const Eigen::Matrix<double, 6, 1>& x,
+                     double rel_tol,
+                     double abs_tol)
+{
+  if (rel_tol <= 0.0  ||  abs_tol <= 0.0) {
+    throw std::invalid_argument("AdamsVsvo::AdamsVsvo() "
+                                "Tolerances must be positive");
+  }
+  m_deq = std::move(deq);
+  m_dt_max = dt.getTu();
+    // Default integration step size if not explicitly set
+  if (m_dt_max == 0.0) {
+    m_dt_max = Duration(0.3, phy_const::tu_per_min).getTu();
+  }
+  m_eps = std::max(rel_tol, abs_tol);
+  m_releps = rel_tol/m_eps;
+  m_abseps = abs_tol/m_eps;
+  m_jd0 = jd;
+  m_jd = jd;
+  m_y = x;
+    // Acceleration at jd
+  m_yp = m_deq->getXdot(m_jd, m_y);
+  m_h = m_dt_max;
+  for (auto& phi : m_phi) {
+    phi.setZero();
+  }
+}
+
+
+JulianDate AdamsVsvo::getT() const noexcept
+{
+  return m_jd;
+}
+
+
+Eigen::Matrix<double, 6, 1> AdamsVsvo::getX() const noexcept
+{
+  return m_y;
+}
+
+
+Eigen::Matrix<double, 6, 1> AdamsVsvo::getXdot() const noexcept
+{
+  return m_yp;
+}
+
+
+/*
+ * Shampine and Gordon STEP - advances the solution by a single step,
+ * adjusting the step size and order for the next.
+ */
+JulianDate AdamsVsvo::step()
+{
+  if (std::fabs(m_h) > std::fabs(m_dt_max)) {
+    m_h = m_dt_max;
+  }
+
+    // Block 0:  Check step size and tolerance vs. machine precision.
+    // Initialize on the first step.
+  if (std::fabs(m_h) < fouru*std::fabs(m_t)) {
+    throw std::runtime_error("AdamsVsvo::step() Step size underflow");
+  }
+  Eigen::Matrix<double, 6, 1> wt;
+  for (int ll=0; ll<6; ++ll) {
+    wt(ll) = m_releps*std::fabs(m_y(ll)) + m_abseps;
+  }
+  const double p5eps {0.5*m_eps};
+  const double round {twou*m_y.cwiseQuotient(wt).norm()};
+  if (p5eps < round) {
+    throw std::runtime_error("AdamsVsvo::step() Error tolerance too small");
+  }
+  m_g[1] = 1.0;
+  m_g[2] = 0.5;
+  m_sig[1] = 1.0;
+  if (m_start) {
+    m_phi[1] = m_yp;
+    m_phi[2].setZero();
+    const double sum {m_yp.cwiseQuotient(wt).norm()};
+    double absh {std::fabs(m_h)};
+    if (m_eps < 16.0*sum*m_h*m_h) {
+      absh = 0.25*std::sqrt(m_eps/sum);
+    }
+    m_h = std::copysign(std::max(absh, fouru*std::fabs(m_t)), m_h);
+    m_hold = 0.0;
+    m_k = 1;
+    m_kold = 0;
+    m_start = false;
+    m_phase1 = true;
+    m_nornd = true;
+    if (p5eps <= 100.0*round) {
+      m_nornd = false;
+      m_phi[15].setZero();
+    }
+  }
+
+  int ifail {0};
+  Eigen::Matrix<double, 6, 1> p;
+  for (;;) {
+      // Block 1:  Compute coefficients for this step, only those
+      // changed if the step size remains the same.
+    const int kp1 {m_k + 1};
+    const int kp2 {m_k + 2};
+    const int km1 {m_k - 1};
+    const int km2 {m_k - 2};
+      // ns is the number of steps taken with size h.  When k < ns,
+      // no coefficients change.
+    if (m_h != m_hold) {
+      m_ns = 0;
+    }
+    if (m_ns <= m_kold) {
+      m_ns++;
+    }
+    const int nsp1 {m_ns + 1};
+    if (m_k >= m_ns) {
+      m_beta[m_ns] = 1.0;
+      m_alpha[m_ns] = 1.0/m_ns;
+      double temp1 {m_h*m_ns};
+      m_sig[nsp1] = 1.0;
+      for (int ii=nsp1; ii<=m_k; ++ii) {
+        const double temp2 {m_psi[ii-1]};
+        m_psi[ii-1] = temp1;
+        m_beta[ii] = m_beta[ii-1]*m_psi[ii-1]/temp2;
+        temp1 = temp2 + m_h;
+        m_alpha[ii] = m_h/temp1;
+        m_sig[ii+1] = ii*m_alpha[ii]*m_sig[ii];
+      }
+      m_psi[m_k] = temp1;
+        // Integration coefficients g
+      if (m_ns <= 1) {
+        for (int iq=1; iq<=m_k; ++iq) {
+          m_v[iq] = 1.0/(iq*(iq + 1));
+          m_w[iq] = m_v[iq];
+        }
+      } else {
+          // Order raised - update diagonal part of v
+        if (m_k > m_kold) {
+          m_v[m_k] = 1.0/(m_k*kp1);
+          for (int jj=1; jj<=m_ns-2; ++jj) {
+            const int ii {m_k - jj};
+            m_v[ii] -= m_alpha[jj+1]*m_v[ii+1];
+          }
+        }
+        const double temp5 {m_alpha[m_ns]};
+        for (int iq=1; iq<=kp1-m_ns; ++iq) {
+          m_v[iq] -= temp5*m_v[iq+1];
+          m_w[iq] = m_v[iq];
+        }
+        m_g[nsp1] = m_w[1];
+      }
+      for (int ii=m_ns+2; ii<=kp1; ++ii) {
+        const double temp6 {m_alpha[ii-1]};
+        for (int iq=1; iq<=kp2-ii; ++iq) {
+          m_w[iq] -= temp6*m_w[iq+1];
+        }
+        m_g[ii] = m_w[1];
+      }
+    }
+
+      // Block 2:  Predict, evaluate, and estimate the local error at
+      // orders k, k-1, and k-2 as if a constant step size were used.
+    for (int ii=nsp1; ii<=m_k; ++ii) {
+      m_phi[ii] *= m_beta[ii];
+    }
+    m_phi[kp2] = m_phi[kp1];
+    m_phi[kp1].setZero();
+    p.setZero();
+    for (int jj=1; jj<=m_k; ++jj) {
+      const int ii {kp1 - jj};
+      p += m_g[ii]*m_phi[ii];
+      m_phi[ii] += m_phi[ii+1];
+    }
+    if (m_nornd) {
+      p = m_y + m_h*p;
+    } else {
+        // Propagated roundoff control
+      for (int ll=0; ll<6; ++ll) {
+        const double tau {m_h*p(ll) - m_phi[15](ll)};
+        p(ll) = m_y(ll) + tau;
+        m_phi[16](ll) = (p(ll) - m_y(ll)) - tau;
+      }
+    }
+    const double told {m_t};
+    m_t += m_h;
+    const double absh {std::fabs(m_h)};
+    m_yp = m_deq->getXdot(m_jd0 + Duration(m_t, 1.0), p,
+                          OdeEvalMethod::predictor);
+    double erkm2 {0.0};
+    double erkm1 {0.0};
+    double erk {0.0};
+    for (int ll=0; ll<6; ++ll) {
+      const double temp3 {1.0/wt(ll)};
+      const double temp4 {m_yp(ll) - m_phi[1](ll)};
+      if (km2 > 0) {
+        erkm2 += std::pow((m_phi[km1](ll) + temp4)*temp3, 2);
+      }
+      if (km2 >= 0) {
+        erkm1 += std::pow((m_phi[m_k](ll) + temp4)*temp3, 2);
+      }
+      erk += std::pow(temp4*temp3, 2);
+    }
+    if (km2 > 0) {
+      erkm2 = absh*m_sig[km1]*gstr[km2]*std::sqrt(erkm2);
+    }
+    if (km2 >= 0) {
+      erkm1 = absh*m_sig[m_k]*gstr[km1]*std::sqrt(erkm1);
+    }
+    const double temp5 {absh*std::sqrt(erk)};
+    const double err {temp5*(m_g[m_k] - m_g[kp1])};
+    erk = temp5*m_sig[kp1]*gstr[m_k];
+    int knew {m_k};
+      // Test if order should be lowered
+    if (km2 > 0) {
+      if (std::max(erkm1, erkm2) <= erk) {
+        knew = km1;
+      }
+    } else if (km2 == 0) {
+      if (erkm1 <= 0.5*erk) {
+        knew = km1;
+      }
+    }
+
+    if (err > m_eps) {
+        // Block 3:  Unsuccessful step - restore t, phi, and psi.  On
+        // the third failure set the order to one, and beyond that use
+        // an optimal step size.
+      m_phase1 = false;
+      m_t = told;
+      for (int ii=1; ii<=m_k; ++ii) {
+        m_phi[ii] = (m_phi[ii] - m_phi[ii+1])/m_beta[ii];
+      }
+      for (int ii=2; ii<=m_k; ++ii) {
+        m_psi[ii-1] = m_psi[ii] - m_h;
+      }
+      ifail++;
+      double temp2 {0.5};
+      if (ifail > 3  &&  p5eps < 0.25*erk) {
+        temp2 = std::sqrt(p5eps/erk);
+      }
+      if (ifail >= 3) {
+        knew = 1;
+      }
+      m_h *= temp2;
+      m_k = knew;
+      m_ns = 0;
+      if (std::fabs(m_h) < fouru*std::fabs(m_t)) {
+        throw std::runtime_error("AdamsVsvo::step() Step size underflow");
+      }
+      continue;
+    }
+
+      // Block 4:  Successful step - correct, evaluate, and update the
+      // differences.  Determine the order and step size for the next
+      // step.
+    m_kold = m_k;
+    m_hold = m_h;
+    const double temp1 {m_h*m_g[kp1]};
+    if (m_nornd) {
+      m_y = p + temp1*(m_yp - m_phi[1]);
+    } else {
+      for (int ll=0; ll<6; ++ll) {
+        const double rho {temp1*(m_yp(ll) - m_phi[1](ll)) - m_phi[16](ll)};
+        m_y(ll) = p(ll) + rho;
+        m_phi[15](ll) = (m_y(ll) - p(ll)) - rho;
+      }
+    }
+    m_yp = m_deq->getXdot(m_jd0 + Duration(m_t, 1.0), m_y,
+                          OdeEvalMethod::corrector);
+    m_phi[kp1] = m_yp - m_phi[1];
+    m_phi[kp2] = m_phi[kp1] - m_phi[kp2];
+    for (int ii=1; ii<=m_k; ++ii) {
+      m_phi[ii] += m_phi[kp1];
+    }
+      // Estimate error at order k+1 unless in the first phase (always
+      // raise order), already decided to lower order, or the step size
+      // has not been constant long enough for a reliable estimate
+    double erkp1 {0.0};
+    if (knew == km1  ||  m_k == kmax) {
+      m_phase1 = false;
+    }
+    bool raise {false};
+    bool lower {false};
+    if (m_phase1) {
+      raise = true;
+    } else if (knew == km1) {
+      lower = true;
+    } else if (kp1 <= m_ns) {
+      erkp1 = absh*gstr[kp1]*m_phi[kp2].cwiseQuotient(wt).norm();
+      if (m_k == 1) {
+        raise = erkp1 < 0.5*erk;
+      } else if (erkm1 <= std::min(erk, erkp1)) {
+        lower = true;
+      } else {
+        raise = erkp1 < erk  &&  m_k != kmax;
+      }
+    }
+    if (raise) {
+      m_k = kp1;
+      erk = erkp1;
+    } else if (lower) {
+      m_k = km1;
+      erk = erkm1;
+    }
+      // Step size for the new order
+    double hnew {m_h + m_h};
+    if (!m_phase1  &&  p5eps < erk*two[m_k+1]) {
+      hnew = m_h;
+      if (p5eps < erk) {
+        const double r {std::pow(p5eps/erk, 1.0/(m_k + 1))};
+        hnew = absh*std::max(0.5, std::min(0.9, r));
+        hnew = std::copysign(std::max(hnew, fouru*std::fabs(m_t)), m_h);
+      }
+    }
+    m_h = hnew;
+    m_jd = m_jd0 + Duration(m_t, 1.0);
+
+    return m_jd;
+  }
+}
+
+
+}
@@ -32,7 +32,8 @@ namespace eom {
 std::vector<state_vector_rec>
 build_celestial(const std::string& name_prefix,
                 const JulianDate& startTime,
-                const JulianDate& stopTime)
+                const JulianDate& stopTime,
+                const LeapSeconds& leapSeconds)
 {
     // Read binary .emb file
   std::string fname = name_prefix + ".emb";
@@ -41,8 +42,9 @@ build_celestial(const std::string& name_prefix,
     throw std::runtime_error("build_celestial() Can't open " + fname);
   }
 
-    // Ephemerides time needs to be converted to UTC
-  LeapSeconds& ls = LeapSeconds::getInstance();
+    // Ephemerides time needs to be converted to UTC - records are
+    // sequential, so track the leap second table entry
+  unsigned long leap_hint {0UL};
 
   double dt_days;
   ifs.read(reinterpret_cast<char*>(&dt_days), sizeof(double));
@@ -66,7 +68,7 @@ build_celestial(const std::string& name_prefix,
         // Stored in units of AU and days.  Leave in J2000 frame
       pos *= phy_const::du_per_km*km_per_au;
       vel *= phy_const::du_per_km*km_per_au*phy_const::day_per_tu;
-      sv_recs.emplace_back(ls.tt2utc(jd), pos, vel);
+      sv_recs.emplace_back(leapSeconds.tt2utc(jd, leap_hint), pos, vel);
     }
     if (jd2 <= jd) {
       covered_set = true;
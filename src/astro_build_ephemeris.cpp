@@ -21,6 +21,9 @@
 #include <astro_ephemeris_file.h>
 #include <astro_sp3_chebyshev.h>
 #include <astro_sp3_hermite.h>
+#include <astro_mapped_ephemeris.h>
+#include <astro_sp_ephemeris.h>
+#include <astro_ephemeris_variant.h>
 
 #include <astro_build.h>
 
@@ -32,6 +35,13 @@ build_ephemeris(const EphemerisFile& efd,
                 const JulianDate& stopTime,
                 const std::shared_ptr<const EcfEciSys>& ecfeciSys)
 {
+    // Binary ephemeris is used as written, spanning its own time range
+  if (efd.getEphFileFormat() == EphFileFormat::eom_binary) {
+    return std::make_unique<MappedEphemeris>(efd.getName(),
+                                             efd.getEphFileName(),
+                                             ecfeciSys);
+  }
+
   std::vector<state_vector_rec> sp3_recs = 
       parse_sp3_file(efd.getEphFileName(), ecfeciSys->getBeginTime(),
                                            ecfeciSys->getEndTime());
@@ -53,6 +63,24 @@ build_ephemeris(const EphemerisFile& efd,
 }
 
 
+EphemerisVariant resolve_ephemeris(const std::shared_ptr<const Ephemeris>& eph)
+{
+  if (auto sp = std::dynamic_pointer_cast<const SpEphemeris>(eph)) {
+    return sp;
+  }
+  if (auto mapped = std::dynamic_pointer_cast<const MappedEphemeris>(eph)) {
+    return mapped;
+  }
+  if (auto sp3 = std::dynamic_pointer_cast<const Sp3Hermite>(eph)) {
+    return sp3;
+  }
+  if (auto sp3 = std::dynamic_pointer_cast<const Sp3Chebyshev>(eph)) {
+    return sp3;
+  }
+  return eph;
+}
+
+
 std::vector<state_vector_rec> parse_sp3_file(const std::string& file_name,
                                              const JulianDate& jdStart,
                                              const JulianDate& jdStop)
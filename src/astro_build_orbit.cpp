@@ -9,25 +9,40 @@
 
 #include <algorithm>
 #include <array>
+#include <execution>
 #include <memory>
+#include <numeric>
+#include <random>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
 
+#include <utl_const.h>
 #include <phy_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <mth_ode_solver.h>
 #include <astro_adams_4th.h>
+#include <astro_adams_vsvo.h>
+#include <astro_gj8.h>
+#include <astro_rkf78.h>
 #include <astro_deq.h>
+#include <astro_dispersion_def.h>
+#include <astro_dispersion_stats.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ensemble_deq.h>
+#include <astro_ensemble_rk4.h>
 #include <astro_ephemeris.h>
 #include <astro_force_model.h>
 #include <astro_gravity.h>
 #include <astro_gravity_jn.h>
 #include <astro_gravity_std.h>
+#include <astro_gravity_std_batch.h>
 #include <astro_hermite1_eph.h>
 #include <astro_hermite1_tc_eph.h>
 #include <astro_kepler.h>
@@ -56,11 +71,179 @@
 
 namespace eom {
 
-std::unique_ptr<Ephemeris> 
-build_orbit(const OrbitDef& orbitParams,
-            const std::shared_ptr<const EcfEciSys>& ecfeciSys,
-            const std::unordered_map<std::string,
+  // Maximum number of members propagated as an ensemble
+static constexpr unsigned long max_ensemble {16UL};
+
+/*
+ * Adds the non-central body force models selected by the SP propagator
+ * configuration to the equations of motion (Deq or EnsembleDeq).
+ */
+template<typename D>
+static void
+add_force_models(D& deq,
+                 const PropagatorConfig& pCfg,
+                 const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+                 const std::unordered_map<std::string,
                                      std::vector<eom::state_vector_rec>>& ceph)
+{
+  if (pCfg.getSunGravityModel() == SunGravityModel::meeus) {
+    auto sunEph = std::make_unique<SunMeeus>(ecfeciSys);
+    std::unique_ptr<ForceModel> sunGrav =
+            std::make_unique<ThirdBodyGravity<SunMeeus>>(phy_const::gm_sun,
+                                                         std::move(sunEph));
+    deq.addForceModel(std::move(sunGrav));
+  } else if (pCfg.getSunGravityModel() == SunGravityModel::eph) {
+    auto sunEph = std::make_unique<Hermite1Eph>("sun",
+                                                ceph.at("sun"),
+                                                pCfg.getStartTime(),
+                                                pCfg.getStopTime(),
+                                                ecfeciSys);
+    std::unique_ptr<ForceModel> sunGrav =
+            std::make_unique<ThirdBodyGravity<Hermite1Eph>>(phy_const::gm_sun,
+                                                            std::move(sunEph));
+    deq.addForceModel(std::move(sunGrav));
+  }
+  if (pCfg.getMoonGravityModel() == MoonGravityModel::meeus) {
+    auto moonEph = std::make_unique<MoonMeeus>(ecfeciSys);
+    std::unique_ptr<ForceModel> moonGrav =
+            std::make_unique<ThirdBodyGravity<MoonMeeus>>(phy_const::gm_moon,
+                                                          std::move(moonEph));
+    deq.addForceModel(std::move(moonGrav));
+  } else if (pCfg.getMoonGravityModel() == MoonGravityModel::eph) {
+    auto moonEph = std::make_unique<Hermite1Eph>("moon",
+                                                 ceph.at("moon"),
+                                                 pCfg.getStartTime(),
+                                                 pCfg.getStopTime(),
+                                                 ecfeciSys);
+    std::unique_ptr<ForceModel> moonGrav =
+            std::make_unique<ThirdBodyGravity<Hermite1Eph>>(phy_const::gm_moon,
+                                                            std::move(moonEph));
+    deq.addForceModel(std::move(moonGrav));
+  }
+  if (pCfg.otherGravityModelsEnabled()) {
+    for (const auto& planet : ceph) {
+      if (planet.first == "moon"  ||  planet.first == "sun") {
+        continue;
+      }
+      double gm_planet {0.0};
+      if (planet.first == "mercury") {
+        gm_planet = phy_const::gm_mercury;
+      } else if (planet.first == "venus") {
+        gm_planet = phy_const::gm_venus;
+      } else if (planet.first == "mars") {
+        gm_planet = phy_const::gm_mars;
+      } else if (planet.first == "jupiter") {
+        gm_planet = phy_const::gm_jupiter;
+      } else if (planet.first == "saturn") {
+        gm_planet = phy_const::gm_saturn;
+      } else if (planet.first == "uranus") {
+        gm_planet = phy_const::gm_uranus;
+      } else if (planet.first == "neptune") {
+        gm_planet = phy_const::gm_neptune;
+      } else if (planet.first == "pluto") {
+        gm_planet = phy_const::gm_pluto;
+      }
+      auto planetEph = std::make_unique<Hermite1TcEph>(planet.first,
+                                                       ceph.at(planet.first),
+                                                       ceph.at("sun"),
+                                                       pCfg.getStartTime(),
+                                                       pCfg.getStopTime(),
+                                                       ecfeciSys);
+      std::unique_ptr<ForceModel> planetGrav =
+          std::make_unique<ThirdBodyGravity<Hermite1TcEph>>(gm_planet,
+                                                        std::move(planetEph));
+      deq.addForceModel(std::move(planetGrav));
+    }
+  }
+}
+
+
+/*
+ * Equations of motion including the force models selected by the
+ * SP propagator configuration.
+ */
+static std::unique_ptr<Deq>
+build_deq(const PropagatorConfig& pCfg,
+          const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+          const std::unordered_map<std::string,
+                                   std::vector<eom::state_vector_rec>>& ceph)
+{
+    // Force model must always include central body
+  std::unique_ptr<Gravity> forceModel {nullptr};
+  if (pCfg.getGravityModel() == GravityModel::jn) {
+    forceModel = std::make_unique<GravityJn>(pCfg.getDegree());
+  } else if (pCfg.getGravityModel() == GravityModel::std) {
+    forceModel = std::make_unique<GravityStd>(pCfg.getDegree(),
+                                              pCfg.getOrder());
+#ifdef GENPL
+  } else if (pCfg.getGravityModel() == GravityModel::gravt) {
+    forceModel = std::make_unique<Gravt>(pCfg.getDegree(), pCfg.getOrder());
+#endif
+  } else {
+    forceModel = std::make_unique<GravityJn>(0);
+  }
+  auto deq = std::make_unique<Deq>(std::move(forceModel), ecfeciSys);
+    // Additional force models
+  add_force_models(*deq, pCfg, ecfeciSys, ceph);
+
+  return deq;
+}
+
+
+/*
+ * Integrator selected by the SP propagator configuration.  A negative
+ * step size integrates backward in time.  Returns nullptr for a
+ * negative step size if the integrator only supports forward
+ * integration.
+ */
+static std::unique_ptr<OdeSolver<JulianDate, double, 6>>
+build_integrator(const PropagatorConfig& pCfg,
+                 std::unique_ptr<Deq> deq,
+                 const Duration& dt,
+                 const JulianDate& epoch,
+                 const Eigen::Matrix<double, 6, 1>& xeci)
+{
+  if (pCfg.getPropagator() == Propagator::rk4s) {
+    if (dt.getTu() < 0.0) {
+      return nullptr;
+    }
+    return std::make_unique<Rk4s>(std::move(deq), epoch, xeci);
+  } else if (pCfg.getPropagator() == Propagator::adams4) {
+    return std::make_unique<Adams4th>(std::move(deq), dt, epoch, xeci);
+  } else if (pCfg.getPropagator() == Propagator::adams) {
+    return std::make_unique<AdamsVsvo>(std::move(deq), dt, epoch, xeci,
+                                       pCfg.getRelativeTolerance(),
+                                       pCfg.getAbsoluteTolerance());
+  } else if (pCfg.getPropagator() == Propagator::gj8) {
+    return std::make_unique<Gj8>(std::move(deq), dt, epoch, xeci);
+  } else if (pCfg.getPropagator() == Propagator::rkf78) {
+    return std::make_unique<Rkf78>(std::move(deq), dt, epoch, xeci,
+                                   pCfg.getRelativeTolerance(),
+                                   pCfg.getAbsoluteTolerance());
+#ifdef GENPL
+  } else if (pCfg.getPropagator() == Propagator::gj) {
+    if (dt.getTu() < 0.0) {
+      return nullptr;
+    }
+    return std::make_unique<GaussJackson>(std::move(deq), epoch, xeci);
+  } else if (pCfg.getPropagator() == Propagator::gjs) {
+    if (dt.getTu() < 0.0) {
+      return nullptr;
+    }
+    return std::make_unique<GjLite>(std::move(deq), epoch, xeci);
+#endif
+  }
+
+  return std::make_unique<Rk4>(std::move(deq), dt, epoch, xeci);
+}
+
+
+/*
+ * Initial Cartesian GCRF state vector of an orbit definition
+ */
+static Eigen::Matrix<double, 6, 1>
+initial_state(const OrbitDef& orbitParams,
+              const std::shared_ptr<const EcfEciSys>& ecfeciSys)
 {
     // Use of NAVSPASUR element sets would change this but they
     // should be restricted to OLEs (as SGP4 is to TLEs)
@@ -97,139 +280,81 @@ build_orbit(const OrbitDef& orbitParams,
                                  xeciVec.block<3, 1>(3, 0));
   }
 
+  return xeciVec;
+}
+
+
+std::unique_ptr<Ephemeris> 
+build_orbit(const OrbitDef& orbitParams,
+            const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+            const std::unordered_map<std::string,
+                                     std::vector<eom::state_vector_rec>>& ceph)
+{
+  Eigen::Matrix<double, 6, 1> xeciVec = initial_state(orbitParams,
+                                                      ecfeciSys);
+
     // Build orbit definition based on propagator configuration
     // Default options are two-body systems if PropagatorConfig
     // values fall out if sync with options checked here.
   PropagatorConfig pCfg = orbitParams.getPropagatorConfig();
   if (pCfg.getPropagatorType() == PropagatorType::sp) {
-      // Force model must always include central body
-    std::unique_ptr<Gravity> forceModel {nullptr};
-    if (pCfg.getGravityModel() == GravityModel::jn) {
-      forceModel = std::make_unique<GravityJn>(pCfg.getDegree());
-    } else if (pCfg.getGravityModel() == GravityModel::std) {
-      forceModel = std::make_unique<GravityStd>(pCfg.getDegree(),
-                                                pCfg.getOrder());
-#ifdef GENPL
-    } else if (pCfg.getGravityModel() == GravityModel::gravt) {
-      forceModel = std::make_unique<Gravt>(pCfg.getDegree(), pCfg.getOrder());
-#endif
-    } else {
-      forceModel = std::make_unique<GravityJn>(0);
+    auto deq = build_deq(pCfg, ecfeciSys, ceph);
+      // Integrator - explicitly apply the default step size so the
+      // backward leg can use the same, negated
+    Duration dt {pCfg.getStepSize()};
+    if (dt.getTu() == 0.0) {
+      dt = Duration(0.3, phy_const::tu_per_min);
     }
-    auto deq = std::make_unique<Deq>(std::move(forceModel), ecfeciSys);
-      // Additional force models
-    if (pCfg.getSunGravityModel() == SunGravityModel::meeus) {
-      std::unique_ptr<Ephemeris> sunEph = std::make_unique<SunMeeus>(ecfeciSys);
-      std::unique_ptr<ForceModel> sunGrav =
-              std::make_unique<ThirdBodyGravity>(phy_const::gm_sun,
-                                                 std::move(sunEph));
-      deq->addForceModel(std::move(sunGrav));
-    } else if (pCfg.getSunGravityModel() == SunGravityModel::eph) {
-      std::unique_ptr<Ephemeris> sunEph =
-          std::make_unique<Hermite1Eph>("sun",
-                                        ceph.at("sun"),
-                                        pCfg.getStartTime(),
-                                        pCfg.getStopTime(),
-                                        ecfeciSys);
-      std::unique_ptr<ForceModel> sunGrav =
-              std::make_unique<ThirdBodyGravity>(phy_const::gm_sun,
-                                                 std::move(sunEph));
-      deq->addForceModel(std::move(sunGrav));
+    std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp =
+        build_integrator(pCfg, std::move(deq), dt,
+                         orbitParams.getEpoch(), xeciVec);
+      // Backward leg if the epoch follows the start time
+    std::unique_ptr<OdeSolver<JulianDate, double, 6>> spBack {nullptr};
+    if (pCfg.getStartTime() < orbitParams.getEpoch()) {
+      spBack = build_integrator(pCfg, build_deq(pCfg, ecfeciSys, ceph),
+                                Duration(-dt.getTu(), 1.0),
+                                orbitParams.getEpoch(), xeciVec);
     }
-    if (pCfg.getMoonGravityModel() == MoonGravityModel::meeus) {
-      std::unique_ptr<Ephemeris> moonEph =
-              std::make_unique<MoonMeeus>(ecfeciSys);
-      std::unique_ptr<ForceModel> moonGrav =
-              std::make_unique<ThirdBodyGravity>(phy_const::gm_moon,
-                                                 std::move(moonEph));
-      deq->addForceModel(std::move(moonGrav));
-    } else if (pCfg.getMoonGravityModel() == MoonGravityModel::eph) {
-      std::unique_ptr<Ephemeris> moonEph =
-          std::make_unique<Hermite1Eph>("moon",
-                                        ceph.at("moon"),
+      // Ready to generate ephemeris
+    if (pCfg.lazyPropagationEnabled()) {
+        // Regenerating released segments requires building force
+        // models after ceph has gone out of scope - retain a copy
+      SpSolverFactory regen {nullptr};
+      if (pCfg.getMaxLazySegments() > 0UL) {
+        auto cephCopy = std::make_shared<const std::unordered_map<
+            std::string, std::vector<eom::state_vector_rec>>>(ceph);
+        regen = [pCfg, ecfeciSys, cephCopy, dt](
+                    const JulianDate& jd,
+                    const Eigen::Matrix<double, 6, 1>& xeci, bool forward) {
+          Duration dtDir {forward ? dt : Duration(-dt.getTu(), 1.0)};
+          return build_integrator(pCfg,
+                                  build_deq(pCfg, ecfeciSys, *cephCopy),
+                                  dtDir, jd, xeci);
+        };
+      }
+      std::unique_ptr<Ephemeris> orbit =
+          std::make_unique<SpEphemeris>(orbitParams.getOrbitName(),
                                         pCfg.getStartTime(),
                                         pCfg.getStopTime(),
-                                        ecfeciSys);
-      std::unique_ptr<ForceModel> moonGrav =
-              std::make_unique<ThirdBodyGravity>(phy_const::gm_moon,
-                                                 std::move(moonEph));
-      deq->addForceModel(std::move(moonGrav));
-    }
-    if (pCfg.otherGravityModelsEnabled()) {
-      for (const auto& planet : ceph) {
-        if (planet.first == "moon"  ||  planet.first == "sun") {
-          continue;
-        }
-        double gm_planet {0.0};
-        if (planet.first == "mercury") {
-          gm_planet = phy_const::gm_mercury;
-        } else if (planet.first == "venus") {
-          gm_planet = phy_const::gm_venus;
-        } else if (planet.first == "mars") {
-          gm_planet = phy_const::gm_mars;
-        } else if (planet.first == "jupiter") {
-          gm_planet = phy_const::gm_jupiter;
-        } else if (planet.first == "saturn") {
-          gm_planet = phy_const::gm_saturn;
-        } else if (planet.first == "uranus") {
-          gm_planet = phy_const::gm_uranus;
-        } else if (planet.first == "neptune") {
-          gm_planet = phy_const::gm_neptune;
-        } else if (planet.first == "pluto") {
-          gm_planet = phy_const::gm_pluto;
-        }
-        std::unique_ptr<Ephemeris> planetEph =
-            std::make_unique<Hermite1TcEph>(planet.first,
-                                            ceph.at(planet.first),
-                                            ceph.at("sun"),
-                                            pCfg.getStartTime(),
-                                            pCfg.getStopTime(),
-                                            ecfeciSys);
-        std::unique_ptr<ForceModel> planetGrav =
-            std::make_unique<ThirdBodyGravity>(gm_planet,
-                                               std::move(planetEph));
-        deq->addForceModel(std::move(planetGrav));
-      }
-    }
-      // Integrator
-    std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp {nullptr};
-    if (pCfg.getPropagator() == Propagator::rk4) {
-      sp = std::make_unique<Rk4>(std::move(deq),
-                                 pCfg.getStepSize(),
-                                 orbitParams.getEpoch(),
-                                 xeciVec);
-    } else if (pCfg.getPropagator() == Propagator::rk4s) {
-      sp = std::make_unique<Rk4s>(std::move(deq),
-                                  orbitParams.getEpoch(),
-                                  xeciVec);
-    } else if (pCfg.getPropagator() == Propagator::adams4) {
-      sp = std::make_unique<Adams4th>(std::move(deq),
-                                      pCfg.getStepSize(),
-                                      orbitParams.getEpoch(),
-                                      xeciVec);
-#ifdef GENPL
-    } else if (pCfg.getPropagator() == Propagator::gj) {
-      sp = std::make_unique<GaussJackson>(std::move(deq),
-                                          orbitParams.getEpoch(),
-                                          xeciVec);
-    } else if (pCfg.getPropagator() == Propagator::gjs) {
-      sp = std::make_unique<GjLite>(std::move(deq),
-                                    orbitParams.getEpoch(),
-                                    xeciVec);
-#endif
-    } else {
-      sp = std::make_unique<Rk4>(std::move(deq),
-                                 pCfg.getStepSize(),
-                                 orbitParams.getEpoch(),
-                                 xeciVec);
+                                        ecfeciSys,
+                                        std::move(sp),
+                                        std::move(spBack),
+                                        pCfg.getLazySegment(),
+                                        pCfg.getMaxLazySegments(),
+                                        std::move(regen),
+                                        pCfg.ecfInterpolationEnabled(),
+                                        pCfg.compactStorageEnabled());
+      return orbit;
     }
-      // Ready to generate ephemeris
     std::unique_ptr<Ephemeris> orbit =
         std::make_unique<SpEphemeris>(orbitParams.getOrbitName(),
                                       pCfg.getStartTime(),
                                       pCfg.getStopTime(),
                                       ecfeciSys,
-                                      std::move(sp));
+                                      std::move(sp),
+                                      std::move(spBack),
+                                      pCfg.ecfInterpolationEnabled(),
+                                      pCfg.compactStorageEnabled());
     return orbit;
   } else if (pCfg.getPropagatorType() == PropagatorType::kepler1) {
     std::unique_ptr<Ephemeris> orbit =
@@ -296,6 +421,268 @@ build_orbit(const OrbitDef& orbitParams,
 }
 
 
+/*
+ * True if the orbit definition may be propagated as an ensemble member
+ */
+static bool ensemble_capable(const OrbitDef& orbitParams)
+{
+  const PropagatorConfig& pCfg = orbitParams.getPropagatorConfig();
+  return pCfg.getPropagatorType() == PropagatorType::sp  &&
+         pCfg.ensembleEnabled()  &&
+         pCfg.getPropagator() == Propagator::rk4  &&
+         pCfg.getGravityModel() == GravityModel::std  &&
+         !pCfg.lazyPropagationEnabled();
+}
+
+
+/*
+ * True if two ensemble capable orbit definitions share an epoch and
+ * the propagator configuration settings relevant to ensembles
+ */
+static bool ensemble_compatible(const OrbitDef& a, const OrbitDef& b)
+{
+  const PropagatorConfig& ac = a.getPropagatorConfig();
+  const PropagatorConfig& bc = b.getPropagatorConfig();
+  return !(a.getEpoch() < b.getEpoch())  &&  !(b.getEpoch() < a.getEpoch())  &&
+         !(ac.getStartTime() < bc.getStartTime())  &&
+         !(bc.getStartTime() < ac.getStartTime())  &&
+         !(ac.getStopTime() < bc.getStopTime())  &&
+         !(bc.getStopTime() < ac.getStopTime())  &&
+         ac.getStepSize().getTu() == bc.getStepSize().getTu()  &&
+         ac.getDegree() == bc.getDegree()  &&
+         ac.getOrder() == bc.getOrder()  &&
+         ac.getSunGravityModel() == bc.getSunGravityModel()  &&
+         ac.getMoonGravityModel() == bc.getMoonGravityModel()  &&
+         ac.otherGravityModelsEnabled() == bc.otherGravityModelsEnabled()  &&
+         ac.ecfInterpolationEnabled() == bc.ecfInterpolationEnabled()  &&
+         ac.compactStorageEnabled() == bc.compactStorageEnabled();
+}
+
+
+/*
+ * Integrate an ensemble from its current state until passing jdEnd,
+ * in the direction indicated, returning records for each member in
+ * the order generated
+ */
+static std::vector<std::vector<eph_record>>
+propagate_ensemble(EnsembleRk4& sp, const JulianDate& jdEnd, bool forward)
+{
+  const Eigen::Index nm {sp.getX().cols()};
+  std::vector<std::vector<eph_record>> eph(nm);
+  auto record = [&sp, &eph, nm]() {
+    const Eigen::Matrix<double, 6, Eigen::Dynamic>& x = sp.getX();
+    const Eigen::Matrix<double, 6, Eigen::Dynamic>& dx = sp.getXdot();
+    for (Eigen::Index ii=0; ii<nm; ++ii) {
+      eph[ii].emplace_back(sp.getT(), x.block<3, 1>(0, ii),
+                                      x.block<3, 1>(3, ii),
+                                      dx.block<3, 1>(3, ii));
+    }
+  };
+  record();
+  JulianDate jdNow = sp.getT();
+  while (forward ? jdNow < jdEnd : jdEnd < jdNow) {
+    jdNow = sp.step();
+    record();
+  }
+
+  return eph;
+}
+
+
+/*
+ * Propagate compatible orbit definitions in lockstep, producing an
+ * SpEphemeris for each.  The padded span matches that used by
+ * SpEphemeris when integrating.
+ */
+static std::vector<std::unique_ptr<Ephemeris>>
+build_ensemble(const std::vector<const OrbitDef*>& members,
+               const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+               const std::unordered_map<std::string,
+                                     std::vector<eom::state_vector_rec>>& ceph)
+{
+  const int nm {static_cast<int>(members.size())};
+  const PropagatorConfig& pCfg = members.front()->getPropagatorConfig();
+  const JulianDate epoch {members.front()->getEpoch()};
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xeci(6, nm);
+  for (int ii=0; ii<nm; ++ii) {
+    xeci.col(ii) = initial_state(*members[ii], ecfeciSys);
+  }
+  Duration dt {pCfg.getStepSize()};
+  if (dt.getTu() == 0.0) {
+    dt = Duration(0.3, phy_const::tu_per_min);
+  }
+  auto build_ensemble_deq = [&pCfg, &ecfeciSys, &ceph, nm]() {
+    auto deq = std::make_unique<EnsembleDeq>(
+        std::make_unique<GravityStdBatch>(pCfg.getDegree(), pCfg.getOrder(),
+                                          nm),
+        ecfeciSys);
+    add_force_models(*deq, pCfg, ecfeciSys, ceph);
+    return deq;
+  };
+
+  EnsembleRk4 sp(build_ensemble_deq(), dt, epoch, xeci);
+  std::vector<std::vector<eph_record>> eph =
+      propagate_ensemble(sp, pCfg.getStopTime() + utl_const::day_per_min,
+                         true);
+    // Backward leg if the epoch follows the start time, prepended in
+    // increasing time order excluding the shared epoch record
+  if (pCfg.getStartTime() < epoch) {
+    EnsembleRk4 spBack(build_ensemble_deq(), Duration(-dt.getTu(), 1.0),
+                       epoch, xeci);
+    std::vector<std::vector<eph_record>> bwd_eph =
+        propagate_ensemble(spBack,
+                           pCfg.getStartTime() + -utl_const::day_per_min,
+                           false);
+    for (int ii=0; ii<nm; ++ii) {
+      eph[ii].insert(eph[ii].begin(), bwd_eph[ii].rbegin(),
+                                      bwd_eph[ii].rend() - 1);
+    }
+  }
+
+  std::vector<std::unique_ptr<Ephemeris>> orbits(nm);
+  for (int ii=0; ii<nm; ++ii) {
+    orbits[ii] = std::make_unique<SpEphemeris>(members[ii]->getOrbitName(),
+                                               pCfg.getStartTime(),
+                                               pCfg.getStopTime(),
+                                               epoch,
+                                               ecfeciSys,
+                                               eph[ii],
+                                               pCfg.ecfInterpolationEnabled(),
+                                               pCfg.compactStorageEnabled());
+    eph[ii].clear();
+    eph[ii].shrink_to_fit();
+  }
+
+  return orbits;
+}
+
+
+std::vector<std::unique_ptr<Ephemeris>>
+build_orbits(const std::vector<OrbitDef>& orbitDefs,
+             const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+             const std::unordered_map<std::string,
+                                      std::vector<eom::state_vector_rec>>& ceph)
+{
+    // Partition into jobs, each either a single orbit definition or an
+    // ensemble of compatible definitions, by index into orbitDefs
+  std::vector<std::vector<unsigned long>> jobs;
+  std::vector<std::vector<unsigned long>> ensembles;
+  for (unsigned long ii=0UL; ii<orbitDefs.size(); ++ii) {
+    if (!ensemble_capable(orbitDefs[ii])) {
+      jobs.push_back({ii});
+      continue;
+    }
+    auto ens = std::find_if(ensembles.begin(), ensembles.end(),
+                            [&orbitDefs, ii](const auto& e) {
+                              return e.size() < max_ensemble  &&
+                                     ensemble_compatible(orbitDefs[e.front()],
+                                                         orbitDefs[ii]);
+                            });
+    if (ens == ensembles.end()) {
+      ensembles.push_back({ii});
+    } else {
+      ens->push_back(ii);
+    }
+  }
+  jobs.insert(jobs.end(), ensembles.begin(), ensembles.end());
+
+  std::vector<std::unique_ptr<Ephemeris>> orbits(orbitDefs.size());
+  std::for_each(std::execution::par, jobs.begin(), jobs.end(),
+                [&orbitDefs, &orbits, &ecfeciSys, &ceph](const auto& job) {
+    if (job.size() == 1UL) {
+      orbits[job.front()] = build_orbit(orbitDefs[job.front()],
+                                        ecfeciSys, ceph);
+      return;
+    }
+    std::vector<const OrbitDef*> members;
+    for (auto ndx : job) {
+      members.push_back(&orbitDefs[ndx]);
+    }
+    auto ensemble = build_ensemble(members, ecfeciSys, ceph);
+    for (unsigned long ii=0UL; ii<job.size(); ++ii) {
+      orbits[job[ii]] = std::move(ensemble[ii]);
+    }
+  });
+
+  return orbits;
+}
+
+
+DispersionStats
+build_dispersion(const DispersionDef& dispDef,
+                 const OrbitDef& templateOrbit,
+                 const JulianDate& start,
+                 const Duration& dt,
+                 unsigned long points,
+                 const std::shared_ptr<const EcfEciSys>& ecfeciSys,
+                 const std::unordered_map<
+                     std::string, std::vector<eom::state_vector_rec>>& ceph)
+{
+  if (templateOrbit.getCoordinateType() == CoordType::tle) {
+    throw std::invalid_argument("build_dispersion() "
+                                "Template orbit must be defined by a "
+                                "state vector: " +
+                                templateOrbit.getOrbitName());
+  }
+  Eigen::Matrix<double, 6, 1> xeci0 = initial_state(templateOrbit, ecfeciSys);
+    // Square root of the covariance via pivoted LDL^T, supporting
+    // semidefinite covariances:  cov = (P^T L sqrt(D))(P^T L sqrt(D))^T
+  Eigen::LDLT<Eigen::Matrix<double, 6, 6>> ldlt(dispDef.getCovariance());
+  Eigen::Matrix<double, 6, 6> sqrt_cov = ldlt.matrixL();
+  sqrt_cov = ldlt.transpositionsP().transpose()*sqrt_cov*
+             ldlt.vectorD().cwiseMax(0.0).cwiseSqrt().asDiagonal();
+  std::mt19937_64 gen(dispDef.getSeed());
+  std::normal_distribution<double> unit_normal;
+
+    // Enough members per block to keep all threads busy when sampled
+    // orbits are propagated as ensembles
+  const unsigned int nthreads {std::max(1U,
+                                        std::thread::hardware_concurrency())};
+  const unsigned long block {max_ensemble*nthreads};
+  const unsigned long nsamp {dispDef.getSamples()};
+  DispersionStats stats(dispDef.getName(), start, dt, points);
+  std::vector<OrbitDef> orbitDefs;
+  std::vector<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvecs;
+  for (unsigned long first=0UL; first<nsamp; first+=block) {
+    const unsigned long nblk {std::min(block, nsamp - first)};
+    orbitDefs.clear();
+    for (unsigned long ii=0UL; ii<nblk; ++ii) {
+      Eigen::Matrix<double, 6, 1> zz;
+      for (int jj=0; jj<6; ++jj) {
+        zz(jj) = unit_normal(gen);
+      }
+      Eigen::Matrix<double, 6, 1> xeci = xeci0 + sqrt_cov*zz;
+      std::array<double, 6> xarr = {xeci(0), xeci(1), xeci(2),
+                                    xeci(3), xeci(4), xeci(5)};
+      std::string name {dispDef.getName() + "_" + std::to_string(first + ii)};
+      orbitDefs.emplace_back(name,
+                             templateOrbit.getPropagatorConfig(),
+                             templateOrbit.getEpoch(),
+                             xarr,
+                             CoordType::cartesian, FrameType::gcrf);
+    }
+    std::vector<std::unique_ptr<Ephemeris>> orbits =
+        build_orbits(orbitDefs, ecfeciSys, ceph);
+      // Sample in parallel, then accumulate in sample order so
+      // results do not depend on thread scheduling
+    xvecs.resize(nblk);
+    std::vector<unsigned long> ndxs(nblk);
+    std::iota(ndxs.begin(), ndxs.end(), 0UL);
+    std::for_each(std::execution::par, ndxs.begin(), ndxs.end(),
+                  [&orbits, &xvecs, &start, &dt, points](unsigned long ndx) {
+      xvecs[ndx].resize(6, points);
+      orbits[ndx]->sample(start, dt, points, EphemFrame::eci, xvecs[ndx]);
+      orbits[ndx].reset();
+    });
+    for (const auto& xvec : xvecs) {
+      stats.accumulate(xvec);
+    }
+  }
+
+  return stats;
+}
+
+
 // Relative orbit definition
 std::unique_ptr<Ephemeris>
 build_orbit(const RelOrbitDef& relOrbit,
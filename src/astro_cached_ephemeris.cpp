@@ -0,0 +1,276 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_cached_ephemeris.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <utl_hash.h>
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <astro_ephemeris.h>
+
+namespace {
+  constexpr std::uint32_t tag_valid {1U};
+  constexpr std::uint32_t tag_ecf {2U};
+  constexpr std::uint32_t tag_vel {4U};
+}
+
+namespace eom {
+
+static_assert(std::atomic<double>::is_always_lock_free,
+              "CachedEphemeris requires lock free atomic<double>");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+              "CachedEphemeris requires lock free atomic<uint32_t>");
+
+
+CachedEphemeris::CachedEphemeris(std::shared_ptr<Ephemeris> eph,
+                                 unsigned long slots)
+{
+  if (eph == nullptr) {
+    throw std::invalid_argument("CachedEphemeris::CachedEphemeris() "
+                                "Null ephemeris");
+  }
+  if (slots == 0UL) {
+    throw std::invalid_argument("CachedEphemeris::CachedEphemeris() "
+                                "Zero slots");
+  }
+  m_eph = std::move(eph);
+  unsigned long nslots {1UL};
+  while (nslots < slots) {
+    nslots <<= 1;
+  }
+  m_mask = nslots - 1UL;
+  m_slots = std::make_unique<slot[]>(nslots);
+}
+
+
+double CachedEphemeris::getHitRate() const noexcept
+{
+  auto hits = this->getHits();
+  auto total = hits + this->getMisses();
+  if (total == 0UL) {
+    return 0.0;
+  }
+  return static_cast<double>(hits)/static_cast<double>(total);
+}
+
+
+Eigen::Matrix<double, 6, 1>
+CachedEphemeris::getStateVector(const JulianDate& jd, EphemFrame frame) const
+{
+  Eigen::Matrix<double, 6, 1> xvec;
+  if (this->lookup(jd, frame, true, xvec.data(), 6)) {
+    this->count(1UL, 0UL);
+    return xvec;
+  }
+  this->count(0UL, 1UL);
+  xvec = m_eph->getStateVector(jd, frame);
+  this->store(jd, frame, true, xvec.data(), 6);
+
+  return xvec;
+}
+
+
+Eigen::Matrix<double, 3, 1>
+CachedEphemeris::getPosition(const JulianDate& jd, EphemFrame frame) const
+{
+  Eigen::Matrix<double, 3, 1> pos;
+  if (this->lookup(jd, frame, false, pos.data(), 3)) {
+    this->count(1UL, 0UL);
+    return pos;
+  }
+  this->count(0UL, 1UL);
+  pos = m_eph->getPosition(jd, frame);
+  this->store(jd, frame, false, pos.data(), 3);
+
+  return pos;
+}
+
+
+void CachedEphemeris::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "CachedEphemeris");
+
+  std::vector<unsigned long> miss;
+  Eigen::Matrix<double, 6, 1> x;
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    if (this->lookup(jd[ii], frame, true, x.data(), 6)) {
+      xvec.col(ii) = x;
+    } else {
+      miss.push_back(ii);
+    }
+  }
+  this->count(jd.size() - miss.size(), miss.size());
+  if (miss.empty()) {
+    return;
+  }
+
+    // Evaluate all at once when nothing was found, else only misses
+  if (miss.size() == jd.size()) {
+    m_eph->getStateVectors(jd, frame, xvec);
+    for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+      x = xvec.col(ii);
+      this->store(jd[ii], frame, true, x.data(), 6);
+    }
+    return;
+  }
+  std::vector<JulianDate> jd_miss;
+  jd_miss.reserve(miss.size());
+  for (auto ii : miss) {
+    jd_miss.push_back(jd[ii]);
+  }
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xmiss(6, miss.size());
+  m_eph->getStateVectors(jd_miss, frame, xmiss);
+  for (unsigned long ii=0UL; ii<miss.size(); ++ii) {
+    xvec.col(miss[ii]) = xmiss.col(ii);
+    x = xmiss.col(ii);
+    this->store(jd_miss[ii], frame, true, x.data(), 6);
+  }
+}
+
+
+void CachedEphemeris::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "CachedEphemeris");
+
+    // Sample times as computed by Ephemeris::sample() implementations
+  const double dt_days {dt.getDays()};
+  unsigned long nhit {0UL};
+  Eigen::Matrix<double, 6, 1> x;
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    if (this->lookup(start + ii*dt_days, frame, true, x.data(), 6)) {
+      xvec.col(ii) = x;
+      nhit++;
+    }
+  }
+  if (nhit == n) {
+    this->count(n, 0UL);
+    return;
+  }
+
+    // Sample all at once when nothing was found, else evaluate misses
+    // individually - misses are not recorded above so no allocation
+    // is needed, and entries replaced since are treated as misses
+  if (nhit == 0UL) {
+    this->count(0UL, n);
+    m_eph->sample(start, dt, n, frame, xvec);
+    for (unsigned long ii=0UL; ii<n; ++ii) {
+      x = xvec.col(ii);
+      this->store(start + ii*dt_days, frame, true, x.data(), 6);
+    }
+    return;
+  }
+  unsigned long nmiss {0UL};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+    if (!this->lookup(jd, frame, true, x.data(), 6)) {
+      x = m_eph->getStateVector(jd, frame);
+      this->store(jd, frame, true, x.data(), 6);
+      nmiss++;
+    }
+    xvec.col(ii) = x;
+  }
+  this->count(n - nmiss, nmiss);
+}
+
+
+std::uint32_t CachedEphemeris::tag(EphemFrame frame, bool vel) noexcept
+{
+  return tag_valid | (frame == EphemFrame::ecf ? tag_ecf : 0U) |
+                     (vel ? tag_vel : 0U);
+}
+
+
+CachedEphemeris::slot& CachedEphemeris::locate(const JulianDate& jd,
+                                               EphemFrame frame) const noexcept
+{
+  double jd_hi {jd.getJdHigh()};
+  double jd_lo {jd.getJdLow()};
+  std::uint64_t hash {fnv1a::offset};
+  fnv1a::hash(hash, &jd_hi, sizeof(jd_hi));
+  fnv1a::hash(hash, &jd_lo, sizeof(jd_lo));
+  fnv1a::hash(hash, &frame, sizeof(frame));
+
+  return m_slots[static_cast<unsigned long>(hash ^ (hash >> 32)) & m_mask];
+}
+
+
+bool CachedEphemeris::lookup(const JulianDate& jd, EphemFrame frame, bool vel,
+                             double* x, int nx) const noexcept
+{
+  const slot& entry = this->locate(jd, frame);
+  std::uint32_t seq1 {entry.seq.load(std::memory_order_acquire)};
+  if (seq1 & 1U) {
+    return false;
+  }
+  std::uint32_t etag {entry.tag.load(std::memory_order_relaxed)};
+  double jd_hi {entry.jd_hi.load(std::memory_order_relaxed)};
+  double jd_lo {entry.jd_lo.load(std::memory_order_relaxed)};
+  for (int ii=0; ii<nx; ++ii) {
+    x[ii] = entry.x[ii].load(std::memory_order_relaxed);
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (entry.seq.load(std::memory_order_relaxed) != seq1) {
+    return false;
+  }
+
+    // A position request is satisfied with or without velocity
+  std::uint32_t rtag {tag(frame, vel)};
+  return (etag & rtag) == rtag  &&  (etag & tag_ecf) == (rtag & tag_ecf)  &&
+         jd_hi == jd.getJdHigh()  &&  jd_lo == jd.getJdLow();
+}
+
+
+void CachedEphemeris::store(const JulianDate& jd, EphemFrame frame, bool vel,
+                            const double* x, int nx) const noexcept
+{
+  slot& entry = this->locate(jd, frame);
+  std::uint32_t seq {entry.seq.load(std::memory_order_relaxed)};
+  if ((seq & 1U)  ||
+      !entry.seq.compare_exchange_strong(seq, seq + 1U,
+                                         std::memory_order_relaxed)) {
+    return;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+  entry.tag.store(tag(frame, vel), std::memory_order_relaxed);
+  entry.jd_hi.store(jd.getJdHigh(), std::memory_order_relaxed);
+  entry.jd_lo.store(jd.getJdLow(), std::memory_order_relaxed);
+  for (int ii=0; ii<nx; ++ii) {
+    entry.x[ii].store(x[ii], std::memory_order_relaxed);
+  }
+  entry.seq.store(seq + 2U, std::memory_order_release);
+}
+
+
+void CachedEphemeris::count(unsigned long hits,
+                            unsigned long misses) const noexcept
+{
+  if (hits > 0UL) {
+    m_hits.count.fetch_add(hits, std::memory_order_relaxed);
+  }
+  if (misses > 0UL) {
+    m_misses.count.fetch_add(misses, std::memory_order_relaxed);
+  }
+}
+
+
+}
@@ -16,12 +16,15 @@
 
 #include <cal_julian_date.h>
 #include <mth_ode.h>
+#include <astro_ecfeci_cursor.h>
+#include <astro_ecfeci_transform.h>
 #include <astro_gravity.h>
 
 namespace eom {
 
 
-Deq::Deq(std::unique_ptr<Gravity> grav, std::shared_ptr<const EcfEciSys> ecfeci)
+Deq::Deq(std::unique_ptr<Gravity> grav,
+         std::shared_ptr<const EcfEciSys> ecfeci) : m_f2i_cursor {ecfeci}
 {
   m_ecfeci = std::move(ecfeci);
   m_grav = std::move(grav);
@@ -32,8 +35,12 @@ Eigen::Matrix<double, 6, 1> Deq::getXdot(const JulianDate& utc,
                                          const Eigen::Matrix<double, 6, 1>& x,
                                          OdeEvalMethod method)
 {
+    // Single ECF/ECI lookup for both directions - integration steps
+    // through time, so the cursor avoids repeated node searches
+  EcfEciTransform f2i {m_f2i_cursor.getTransform(utc)};
+
     // Central body gravity model
-  Eigen::Matrix<double, 3, 1> posf = m_ecfeci->eci2ecf(utc, x.block<3,1>(0,0));
+  Eigen::Matrix<double, 3, 1> posf = f2i.eci2ecf(x.block<3,1>(0,0));
   Eigen::Matrix<double, 3, 1> a_i_f = m_grav->getAcceleration(posf, method);
 
   Eigen::Matrix<double, 6, 1> xd;
@@ -41,7 +48,7 @@ Eigen::Matrix<double, 6, 1> Deq::getXdot(const JulianDate& utc,
   xd.block<3,1>(0,0) = x.block<3,1>(3,0);
     // Acceleration derivative is w.r.t. ECI, but need to transform
     // vector components to ECI frame
-  xd.block<3,1>(3,0) = m_ecfeci->ecf2eci(utc, a_i_f);
+  xd.block<3,1>(3,0) = f2i.ecf2eci(a_i_f);
 
     // Add non-central body accelerations
   if (m_fmodels.size() > 0) {
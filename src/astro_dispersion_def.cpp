@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_dispersion_def.h>
+
+#include <string>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+namespace eom {
+
+DispersionDef::DispersionDef(const std::string& name,
+                             const std::string& template_name,
+                             unsigned long samples,
+                             unsigned long seed,
+                             const Eigen::Matrix<double, 6, 6>& covariance,
+                             const std::string& file_name)
+{
+  if (samples < 2UL) {
+    throw std::invalid_argument("DispersionDef::DispersionDef() "
+                                "At least two samples required");
+  }
+  if (!covariance.isApprox(covariance.transpose())) {
+    throw std::invalid_argument("DispersionDef::DispersionDef() "
+                                "Covariance not symmetric");
+  }
+    // Zero variances are allowed, e.g., no velocity uncertainty
+  Eigen::LDLT<Eigen::Matrix<double, 6, 6>> ldlt(covariance);
+  if (ldlt.info() != Eigen::Success  ||
+      (ldlt.vectorD().array() < 0.0).any()) {
+    throw std::invalid_argument("DispersionDef::DispersionDef() "
+                                "Covariance not positive semidefinite");
+  }
+  m_name = name;
+  m_ref_name = template_name;
+  m_samples = samples;
+  m_seed = seed;
+  m_cov = covariance;
+  m_file_name = file_name;
+}
+
+
+}
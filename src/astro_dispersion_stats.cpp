@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_dispersion_stats.h>
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+
+namespace eom {
+
+DispersionStats::DispersionStats(const std::string& name,
+                                 const JulianDate& start,
+                                 const Duration& dt,
+                                 unsigned long points) :
+                                 m_name {name},
+                                 m_start {start},
+                                 m_dt {dt},
+                                 m_m2(points,
+                                      Eigen::Matrix<double, 6, 6>::Zero())
+{
+  m_mean = Eigen::Matrix<double, 6, Eigen::Dynamic>::Zero(6, points);
+}
+
+
+void DispersionStats::accumulate(
+    const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xvec)
+{
+  if (static_cast<unsigned long>(xvec.cols()) < m_m2.size()) {
+    throw std::invalid_argument("DispersionStats::accumulate() "
+                                "Too few points in time");
+  }
+  m_samples++;
+  const double inv_n {1.0/m_samples};
+  for (unsigned long ii=0UL; ii<m_m2.size(); ++ii) {
+    Eigen::Matrix<double, 6, 1> dx_prev = xvec.col(ii) - m_mean.col(ii);
+    m_mean.col(ii) += inv_n*dx_prev;
+    m_m2[ii] += dx_prev*(xvec.col(ii) - m_mean.col(ii)).transpose();
+  }
+}
+
+
+JulianDate DispersionStats::getTime(unsigned long ndx) const
+{
+  return m_start + ndx*m_dt.getDays();
+}
+
+
+Eigen::Matrix<double, 6, 1> DispersionStats::getMean(unsigned long ndx) const
+{
+  return m_mean.col(ndx);
+}
+
+
+Eigen::Matrix<double, 6, 6>
+DispersionStats::getCovariance(unsigned long ndx) const
+{
+  if (m_samples < 2UL) {
+    return Eigen::Matrix<double, 6, 6>::Zero();
+  }
+    // Symmetric by construction other than rounding
+  Eigen::Matrix<double, 6, 6> cov = m_m2[ndx]/(m_samples - 1UL);
+  return 0.5*(cov + cov.transpose());
+}
+
+
+}
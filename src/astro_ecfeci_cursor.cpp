@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_ecfeci_cursor.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+#include <cal_julian_date.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_transform.h>
+
+namespace eom {
+
+
+EcfEciCursor::EcfEciCursor(std::shared_ptr<const EcfEciSys> ecfeci)
+{
+  m_ecfeci = std::move(ecfeci);
+  m_per_rate = 1.0/m_ecfeci->rate_days;
+}
+
+
+ecf_eci EcfEciCursor::getEcfEciData(const JulianDate& utc)
+{
+  const EcfEciSys& sys = *m_ecfeci;
+  if (utc - sys.jdStart < 0.0  ||  sys.jdStop - utc < 0.0) {
+    throw std::out_of_range("EcfEciCursor::getEcfEciData() Time out of range");
+  }
+
+    // Nothing to retain when not interpolating
+  if (sys.nfi == 1UL  ||  !sys.interpolate_bpnpm) {
+    return sys.interpolate(utc);
+  }
+
+  double mjd2000 {utc.getMjd2000()};
+  this->seek(utc, mjd2000);
+  if (sys.cheby_cip) {
+    return sys.interpolateCip(utc, m_ndx);
+  }
+
+  double dt {(mjd2000 - m_mjd1)*m_per_rate};
+  ecf_eci f2i {mjd2000, m_ut1mutc + dt*m_dut1mutc, m_lod + dt*m_dlod,
+               m_pm.at(dt), m_bpn.at(dt)};
+
+  return f2i;
+}
+
+
+EcfEciTransform EcfEciCursor::getTransform(const JulianDate& utc)
+{
+  return m_ecfeci->transform(utc, this->getEcfEciData(utc), m_era);
+}
+
+
+void EcfEciCursor::seek(const JulianDate& utc, double mjd2000)
+{
+  const EcfEciSys& sys = *m_ecfeci;
+
+    // Remain on the current interval, step to the next, or search
+  unsigned long ndx {0UL};
+  if (m_valid) {
+    double dt {(mjd2000 - m_mjd1)*m_per_rate};
+    if (dt >= 0.0  &&  dt < 1.0) {
+      return;
+    } else if (dt >= 1.0  &&  dt < 2.0  &&  m_ndx + 2UL < sys.nfi) {
+      ndx = m_ndx + 1UL;
+    } else {
+      ndx = static_cast<unsigned long>((utc - sys.jdStart)/sys.rate_days);
+    }
+  } else {
+    ndx = static_cast<unsigned long>((utc - sys.jdStart)/sys.rate_days);
+  }
+
+  m_ndx = ndx;
+  m_valid = true;
+  sys.loadNode(ndx);
+  const ecf_eci& f2i1 = sys.f2iData[ndx];
+  m_mjd1 = f2i1.mjd2000;
+    // Chebyshev interpolation uses the node index only
+  if (sys.cheby_cip) {
+    return;
+  }
+
+  sys.loadNode(ndx + 1UL);
+  const ecf_eci& f2i2 = sys.f2iData[ndx + 1UL];
+  m_ut1mutc = f2i1.ut1mutc;
+  m_dut1mutc = f2i2.ut1mutc - f2i1.ut1mutc;
+  m_lod = f2i1.lod;
+  m_dlod = f2i2.lod - f2i1.lod;
+  m_bpn.set(f2i1.bpn, f2i2.bpn);
+  m_pm.set(f2i1.pm, f2i2.pm);
+}
+
+
+void EcfEciCursor::qslerp::set(const Eigen::Quaterniond& q1,
+                               const Eigen::Quaterniond& q2)
+{
+  qa = q1;
+  qb = q2;
+  double d {q1.dot(q2)};
+  double absd {std::abs(d)};
+  flip = d < 0.0;
+  linear = absd >= 1.0 - std::numeric_limits<double>::epsilon();
+  if (!linear) {
+    theta = std::acos(absd);
+    inv_sin = 1.0/std::sin(theta);
+  }
+}
+
+
+Eigen::Quaterniond EcfEciCursor::qslerp::at(double t) const
+{
+  double scale0 {1.0 - t};
+  double scale1 {t};
+  if (!linear) {
+    scale0 = inv_sin*std::sin((1.0 - t)*theta);
+    scale1 = inv_sin*std::sin(t*theta);
+  }
+  if (flip) {
+    scale1 = -scale1;
+  }
+
+  return Eigen::Quaterniond(scale0*qa.coeffs() + scale1*qb.coeffs());
+}
+
+
+}
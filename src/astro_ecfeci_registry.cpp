@@ -0,0 +1,154 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_ecfeci_registry.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_eop_sys.h>
+#include <astro_ecfeci_sys.h>
+
+namespace eom {
+
+
+EcfEciRegistry::EcfEciRegistry(const std::string& eop_file) :
+                               m_eop_file {eop_file}
+{
+}
+
+
+std::shared_ptr<const EcfEciSys>
+EcfEciRegistry::getEcfEciSys(const JulianDate& startTime,
+                             const JulianDate& stopTime,
+                             const Duration& dt,
+                             std::shared_ptr<const LeapSeconds> leapSeconds,
+                             bool lazy,
+                             bool chebyshev,
+                             const std::string& cache_dir)
+{
+  registry_entry req;
+  req.jdStart = startTime;
+  req.jdStop = stopTime;
+  req.rate_days = dt.getDays();
+  req.leap_hash = leapSeconds->getHash();
+  req.lazy = lazy;
+  req.chebyshev = chebyshev;
+  req.cache_dir = cache_dir;
+  auto compatible = [&req](const registry_entry& entry) {
+    return entry.rate_days == req.rate_days  &&
+           entry.leap_hash == req.leap_hash  &&
+           entry.lazy == req.lazy  &&
+           entry.chebyshev == req.chebyshev  &&
+           entry.cache_dir == req.cache_dir;
+  };
+    // Held only by the registry - failed services are removed before
+    // the exception is made available, so get() won't throw here
+  auto unused = [](const registry_entry& entry) {
+    return entry.f2iSys.wait_for(std::chrono::seconds(0)) ==
+                                 std::future_status::ready  &&
+           entry.f2iSys.get().use_count() == 1;
+  };
+
+    // The lock only guards the registry itself.  Services are generated
+    // outside of it with other requests for the same span waiting on
+    // the shared_future.
+  std::promise<std::shared_ptr<const EcfEciSys>> build;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+      // Existing service covering the request, possibly still being
+      // generated
+    std::shared_future<std::shared_ptr<const EcfEciSys>> existing;
+    for (const auto& entry : m_entries) {
+      if (compatible(entry)  &&
+          entry.jdStart <= startTime  &&  stopTime <= entry.jdStop) {
+        existing = entry.f2iSys;
+        break;
+      }
+    }
+
+    if (!existing.valid()) {
+        // Release services no longer in use first so they don't widen
+        // the new service.  The new service spans the request and any
+        // overlapping services still held, which are replaced.
+      std::vector<registry_entry> keep;
+      for (auto& entry : m_entries) {
+        if (unused(entry)) {
+          continue;
+        }
+        if (compatible(entry)  &&
+            entry.jdStart <= req.jdStop  &&  req.jdStart <= entry.jdStop) {
+          if (entry.jdStart < req.jdStart) {
+            req.jdStart = entry.jdStart;
+          }
+          if (req.jdStop < entry.jdStop) {
+            req.jdStop = entry.jdStop;
+          }
+        } else {
+          keep.push_back(std::move(entry));
+        }
+      }
+      m_entries = std::move(keep);
+
+      req.id = m_next_id++;
+      req.f2iSys = build.get_future().share();
+      m_entries.push_back(req);
+    } else {
+      req.f2iSys = existing;
+    }
+  }
+  if (req.id == 0) {
+    return req.f2iSys.get();
+  }
+
+  try {
+    std::shared_ptr<EopSys> eopSys {nullptr};
+    if (!m_eop_file.empty()) {
+      eopSys = std::make_shared<EopSys>(m_eop_file, req.jdStart, req.jdStop,
+                                        cache_dir);
+    }
+    build.set_value(std::make_shared<const EcfEciSys>(req.jdStart, req.jdStop,
+                                                      dt, eopSys,
+                                                      std::move(leapSeconds),
+                                                      true, lazy, chebyshev,
+                                                      cache_dir));
+  } catch (...) {
+      // Allow subsequent requests to retry
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                     [&req](const registry_entry& entry) {
+                                       return entry.id == req.id;
+                                     }), m_entries.end());
+    }
+    build.set_exception(std::current_exception());
+  }
+
+  return req.f2iSys.get();
+}
+
+
+unsigned long EcfEciRegistry::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return static_cast<unsigned long>(m_entries.size());
+}
+
+
+}
@@ -9,12 +9,17 @@
 #include <astro_ecfeci_sys.h>
 
 #include <utl_const.h>
+#include <utl_hash.h>
+#include <utl_mapped_file.h>
 #include <phy_const.h>
+#include <cal_const.h>
 #include <cal_duration.h>
 #include <cal_greg_date.h>
 #include <cal_julian_date.h>
 #include <cal_leap_seconds.h>
 #include <astro_eop_sys.h>
+#include <mth_chebyshev.h>
+#include <astro_ecfeci_transform.h>
 
 #include <sofa.h>
 #include <sofam.h>
@@ -22,7 +27,22 @@
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <utility>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <execution>
+#include <mutex>
 #include <stdexcept>
 
 /*
@@ -33,6 +53,13 @@
  */
 static Eigen::Matrix3d from3x3(double mtx[3][3]);
 
+/*
+ * Forms the BPN (CIRF to GCRF) and polar motion (ITRF to TIRF)
+ * quaternions from CIP, CIO/TIO locator, and polar motion values.
+ */
+static void cip2quat(const eom::cip_pm& cip,
+                     Eigen::Quaterniond& bpn, Eigen::Quaterniond& pm);
+
 /*
  * Nomenclature (IAU typically uses "System" vs. "Frame", e.g., GCRS
  * vs.. GCRF.
@@ -47,6 +74,168 @@ namespace {
   constexpr double offset_0 {0.25};
     // Percentage of rate_days to use as buffer for jdStart and jdStop
   constexpr double p_offset {0.25};
+    // Number of nodes generated at once when lazy loading
+  constexpr unsigned long block_size {64UL};
+    // Order of Chebyshev CIP and EOP interpolation, and the number of
+    // nodes used with each fit
+  constexpr int cip_order {3};
+  constexpr unsigned long cip_nodes {cip_order + 1};
+
+    // Binary cache file identification and format version
+  constexpr char cache_magic[8] {'E', 'O', 'M', 'F', '2', 'I', '\0', '\0'};
+  constexpr std::uint32_t cache_version {2};
+    // Doubles per node:  ecf_eci 11, meme_eci p76 4, cip_pm 6
+  constexpr std::uint32_t cache_ndbl {21};
+
+    // Cache file header - key values followed by the number of nodes
+  struct cache_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t ndbl;
+    double jd_start_high;
+    double jd_start_low;
+    double jd_stop_high;
+    double jd_stop_low;
+    double rate_days;
+    std::uint64_t leap_hash;
+    std::uint64_t eop_hash;
+    std::uint64_t nfi;
+  };
+
+    // Nodes are evenly spaced, so the Chebyshev fit to cip_nodes values
+    // over [-1, 1] reduces to a fixed matrix mapping values to
+    // coefficients
+  const Eigen::Matrix<double, cip_nodes, cip_nodes> cip_fit = []() {
+    Eigen::Matrix<double, cip_nodes, cip_nodes> tmat;
+    for (unsigned long ii=0UL; ii<cip_nodes; ++ii) {
+      double t {-1.0 + 2.0*ii/(cip_nodes - 1UL)};
+      tmat.row(ii) = eom::chebyshev::poly<double, cip_order>(t);
+    }
+    return Eigen::Matrix<double, cip_nodes, cip_nodes>(tmat.inverse());
+  }();
+
+    // Earth rotation angle rate w.r.t. UT1, radians/day, and the
+    // largest increment applied via series expansion before the angle
+    // is evaluated directly again
+  constexpr double era_rate {D2PI*1.00273781191135448};
+  constexpr double era_max_step {0.5};
+
+    // IAU 1982 GMST less the earth rotation angle, radians.  The UT1
+    // day fraction common to iauGmst82() and iauEra00() cancels,
+    // leaving a slowly varying polynomial in time - no trig or
+    // additional SOFA calls are needed to form the TEME rotation
+  double gmst82_era(const eom::JulianDate& ut1)
+  {
+    double tu {(ut1.getJdHigh() - DJ00) + ut1.getJdLow()};
+    double t {tu/DJC};
+    double gmst_sec {24110.54841 - cal_const::sec_per_day/2.0 +
+                     (8640184.812866 + (0.093104 - 6.2e-6*t)*t)*t};
+    return std::remainder(D2PI*(gmst_sec/cal_const::sec_per_day -
+                                0.7790572732640 -
+                                0.00273781191135448*tu), D2PI);
+  }
+
+    // Largest angle, radians, for which the half angle series below is
+    // exact to double precision.  CIO/TIO locators and polar motion are
+    // orders of magnitude smaller.
+  constexpr double cip_max_series {1.0e-4};
+
+    // Cosine and sine of half of angle a, radians
+  void half_angle(double a, double& ca, double& sa)
+  {
+    if (std::abs(a) < cip_max_series) {
+      double h2 {0.25*a*a};
+      ca = 1.0 - 0.5*h2*(1.0 - h2/12.0);
+      sa = 0.5*a*(1.0 - h2/6.0);
+    } else {
+      ca = std::cos(0.5*a);
+      sa = std::sin(0.5*a);
+    }
+  }
+
+    // Same rotations as cip2quat(), formed directly as quaternions.
+    // The CIP unit vector (X, Y, Z) gives the half angle terms of the
+    // rotation taking the pole to the CIP without trig functions, and
+    // the remaining rotations are through small angles.  Used when
+    // interpolating, where SOFA matrices and matrix to quaternion
+    // conversions would dominate the cost of each lookup.
+  void cip2quat_direct(const eom::cip_pm& cip,
+                       Eigen::Quaterniond& bpn, Eigen::Quaterniond& pm)
+  {
+      // BPN = Rz(E)*Ry(d)*Rz(-E)*Rz(-s), active, with Z = cos(d)
+    double zc {std::sqrt(1.0 - cip.x*cip.x - cip.y*cip.y)};
+    double cd {std::sqrt(0.5*(1.0 + zc))};
+    double hd {0.5/cd};
+    double cs, ss;
+    half_angle(cip.s, cs, ss);
+    bpn = Eigen::Quaterniond(cd, -hd*cip.y, hd*cip.x, 0.0)*
+          Eigen::Quaterniond(cs, 0.0, 0.0, -ss);
+      // PM = Rz(s')*Ry(-xp)*Rx(-yp), active
+    double csp, ssp, cxp, sxp, cyp, syp;
+    half_angle(cip.sp, csp, ssp);
+    half_angle(cip.xp, cxp, sxp);
+    half_angle(cip.yp, cyp, syp);
+    pm = Eigen::Quaterniond(csp, 0.0, 0.0, ssp)*
+         Eigen::Quaterniond(cxp, 0.0, -sxp, 0.0)*
+         Eigen::Quaterniond(cyp, -syp, 0.0, 0.0);
+  }
+
+    // Number of times for which batch conversions gather transformation
+    // parameters at once, sizing scratch space held on the stack
+  constexpr int batch_block {64};
+
+    // Transformation parameters for a block of times, stored by
+    // parameter rather than by time.  Rotation matrices are stored
+    // column major, one per column.
+  struct f2i_block {
+    Eigen::Map<const Eigen::Matrix3d> bpnAt(Eigen::Index jj) const
+    {
+      return Eigen::Map<const Eigen::Matrix3d>(bpn.col(jj).data());
+    }
+    Eigen::Map<const Eigen::Matrix3d> pmAt(Eigen::Index jj) const
+    {
+      return Eigen::Map<const Eigen::Matrix3d>(pm.col(jj).data());
+    }
+
+    Eigen::Matrix<double, 9, batch_block> bpn;      // CIRF to GCRF
+    Eigen::Matrix<double, 9, batch_block> pm;       // ITRF to TIRF
+    Eigen::Array<double, 1, batch_block> cera;      // TIRF to CIRF
+    Eigen::Array<double, 1, batch_block> sera;
+    Eigen::Array<double, 1, batch_block> gmst_era;
+    Eigen::Array<double, 1, batch_block> cgst;      // TIRF to TEME
+    Eigen::Array<double, 1, batch_block> sgst;
+    Eigen::Array<double, 1, batch_block> we;
+  };
+
+    // Rotation of v about the z-axis given the cosine and sine of the
+    // angle, and the inverse rotation
+  Eigen::Matrix<double, 3, 1> rz(double c, double s,
+                                 const Eigen::Matrix<double, 3, 1>& v)
+  {
+    return {c*v(0) - s*v(1), s*v(0) + c*v(1), v(2)};
+  }
+  Eigen::Matrix<double, 3, 1> rzt(double c, double s,
+                                  const Eigen::Matrix<double, 3, 1>& v)
+  {
+    return {c*v(0) + s*v(1), c*v(1) - s*v(0), v(2)};
+  }
+
+    // Cross product of the earth angular velocity vector with v
+  Eigen::Matrix<double, 3, 1> wcross(double we,
+                                     const Eigen::Matrix<double, 3, 1>& v)
+  {
+    return {-we*v(1), we*v(0), 0.0};
+  }
+
+    // Batch output storage must match the input
+  void check_output(Eigen::Index nin, Eigen::Index nout, const char* caller)
+  {
+    using namespace std::string_literals;
+    if (nin != nout) {
+      throw std::invalid_argument("EcfEciSys::"s + caller +
+                                  "() Input and output sizes differ");
+    }
+  }
 }
 
 namespace eom {
@@ -55,9 +244,16 @@ EcfEciSys::EcfEciSys(const JulianDate& startTime,
                      const JulianDate& stopTime,
                      const Duration& dt,
                      const std::shared_ptr<eom::EopSys>& eopSys,
-                     bool interpolate) :
+                     std::shared_ptr<const LeapSeconds> leapSeconds,
+                     bool interpolate,
+                     bool lazy,
+                     bool chebyshev,
+                     const std::string& cache_dir) :
                      jdStart {startTime}, jdStop {stopTime},
-                     rate_days {dt.getDays()}, interpolate_bpnpm {interpolate}
+                     rate_days {dt.getDays()}, interpolate_bpnpm {interpolate},
+                     lazy_load {lazy}, cheby_cip {chebyshev},
+                     m_eopSys {eopSys},
+                     m_leapSeconds {std::move(leapSeconds)}
 {
     // Put a small buffer around start and stop to minimize logic
     // locating ECFECI data
@@ -73,67 +269,50 @@ EcfEciSys::EcfEciSys(const JulianDate& startTime,
     jdStop  +=  rate_days;
   }
 
-    // Variables used for intermediate calculations within loop.
-  double x;                       // Celestial Intermediate Pole x coordinate
-  double y;                       // Celestial Intermediate Pole y coordinate
-  double s;                       // CIO locator, radians
-  double cirf2gcrf[3][3];         // CIRF to GCRF
-  double itrf2tirf[3][3];         // ITRF to TIRF
-  double mod2j2000[3][3];         // MOD to J2000
-    //
-  LeapSeconds& ls = LeapSeconds::getInstance();
-  auto jd = jdStart;
+  jdNode0 = jdStart;
     // If only one message, compute for middle time and set rate
     // to be the full duration of the time period
   if (rate_days == 0.0) {
     rate_days = jdStop - jdStart;
-    jd += rate_days/2.0;
-  }
-  while (jd <= jdStop) {
-    ecf_eci f2i;
-    meme_eci i2i;
-    f2i.mjd2000 = jd.getMjd2000();
-    i2i.mjd2000 = f2i.mjd2000;
-    eop_record eop;
-    auto jdTT = ls.utc2tt(jd);
-      // Pole locations for BPN
-    iauXys06a(jdTT.getJdHigh(), jdTT.getJdLow(), &x, &y, &s);
-      // Get EOP data is available
-    if (eopSys != nullptr) {
-      eop = eopSys->getEop(jd);
-      f2i.ut1mutc = phy_const::tu_per_sec*eop.ut1mutc;
-      f2i.lod = phy_const::tu_per_sec*0.001*eop.lod;       // TU per msec
-      x += utl_const::rad_per_mas*eop.dx;
-      y += utl_const::rad_per_mas*eop.dy;
+    jdNode0 += rate_days/2.0;
+  }
+  for (auto jd = jdNode0; jd <= jdStop; jd += rate_days) {
+    nfi++;
+  }
+    // Size fixed after initialization
+  f2iData.resize(nfi);
+  memeData.resize(nfi);
+  cipData.resize(nfi);
+  if (nfi < cip_nodes) {
+    cheby_cip = false;
+  }
+
+  std::string cache_file {""};
+  bool cached {false};
+  if (!cache_dir.empty()) {
+    cache_file = cache_dir + "/" + this->cacheName();
+    cached = this->readCache(cache_file);
+      // A new cache file requires all nodes
+    if (!cached) {
+      lazy_load = false;
+    }
+  }
+
+    // Each node is independent of the others
+  if (lazy_load) {
+    m_block_loaded = std::make_unique<std::once_flag[]>(
+                                         (nfi + block_size - 1UL)/block_size);
+  } else if (!cached) {
+    std::vector<unsigned long> ndxs(nfi);
+    std::iota(ndxs.begin(), ndxs.end(), 0UL);
+    std::for_each(std::execution::par,
+                  ndxs.begin(), ndxs.end(),
+                  [this](unsigned long ndx) { this->setNode(ndx); });
+    if (!cache_file.empty()) {
+      this->writeCache(cache_file);
     }
-      // Transpose of BPN, to BPN
-    iauC2ixys(x, y, s, cirf2gcrf); 
-    iauTr(cirf2gcrf, cirf2gcrf);
-      // CIO locator used for polar motion transformation
-    double sp {iauSp00(jdTT.getJdHigh(), jdTT.getJdLow())};
-      // Polar motion, ECF to ECI after transpose
-    iauPom00(utl_const::rad_per_arcsec*eop.xp,
-             utl_const::rad_per_arcsec*eop.yp, sp, itrf2tirf);
-    iauTr(itrf2tirf, itrf2tirf);
-      // Convert to final form and insert
-    Eigen::Matrix3d mbpn = from3x3(cirf2gcrf);
-    Eigen::Matrix3d mpm = from3x3(itrf2tirf);
-    Eigen::Quaterniond qbpn(mbpn);
-    Eigen::Quaterniond qpm(mpm);
-    f2i.pm = qpm;
-    f2i.bpn = qbpn;
-      // IAU 76 Precession to support legacy celestial algorithms
-    iauPmat76(jdTT.getJdHigh(), jdTT.getJdLow(), mod2j2000);
-    iauTr(mod2j2000, mod2j2000);
-    Eigen::Matrix3d mp76 = from3x3(mod2j2000);
-    Eigen::Quaterniond qp76(mp76);
-    i2i.p76 = qp76;
-      // Store records
-    f2iData.push_back(f2i);
-    memeData.push_back(i2i);
-
-    jd += rate_days;
   }
+
     // Frame Bias - time independent
   {
     double gamb, phib, psib, eps;
@@ -148,32 +327,227 @@ EcfEciSys::EcfEciSys(const JulianDate& startTime,
     Eigen::Quaterniond qrbt(mrbt);
     bt = qrbt;
   }
-    // Size fixed after initialization
-  nfi = static_cast<unsigned long>(f2iData.size());
+}
+
+
+void EcfEciSys::setNode(unsigned long ndx) const
+{
+    // Variables used for intermediate calculations
+  double mod2j2000[3][3];         // MOD to J2000
+    //
+  auto jd = jdNode0 + ndx*rate_days;
+
+  ecf_eci f2i;
+  meme_eci i2i;
+  cip_pm cip;
+  f2i.mjd2000 = jd.getMjd2000();
+  i2i.mjd2000 = f2i.mjd2000;
+  eop_record eop;
+  auto jdTT = m_leapSeconds->utc2tt(jd);
+    // Pole locations for BPN
+  iauXys06a(jdTT.getJdHigh(), jdTT.getJdLow(), &cip.x, &cip.y, &cip.s);
+    // Get EOP data is available
+  if (m_eopSys != nullptr) {
+    eop = m_eopSys->getEop(jd);
+    f2i.ut1mutc = phy_const::tu_per_sec*eop.ut1mutc;
+    f2i.lod = phy_const::tu_per_sec*0.001*eop.lod;       // TU per msec
+    cip.x += utl_const::rad_per_mas*eop.dx;
+    cip.y += utl_const::rad_per_mas*eop.dy;
+  }
+    // CIO locator used for polar motion transformation
+  cip.sp = iauSp00(jdTT.getJdHigh(), jdTT.getJdLow());
+  cip.xp = utl_const::rad_per_arcsec*eop.xp;
+  cip.yp = utl_const::rad_per_arcsec*eop.yp;
+    // BPN and polar motion, ECF to ECI
+  cip2quat(cip, f2i.bpn, f2i.pm);
+    // IAU 76 Precession to support legacy celestial algorithms
+  iauPmat76(jdTT.getJdHigh(), jdTT.getJdLow(), mod2j2000);
+  iauTr(mod2j2000, mod2j2000);
+  Eigen::Matrix3d mp76 = from3x3(mod2j2000);
+  Eigen::Quaterniond qp76(mp76);
+  i2i.p76 = qp76;
+    // Store records
+  f2iData[ndx] = f2i;
+  memeData[ndx] = i2i;
+  cipData[ndx] = cip;
+}
+
+
+std::string EcfEciSys::cacheName() const
+{
+  std::uint64_t eop_hash {(m_eopSys == nullptr) ? 0 : m_eopSys->getHash()};
+  std::uint64_t leap_hash {m_leapSeconds->getHash()};
+  double key[] {jdStart.getJdHigh(), jdStart.getJdLow(),
+                jdStop.getJdHigh(), jdStop.getJdLow(), rate_days};
+  std::uint64_t hash {fnv1a::offset};
+  fnv1a::hash(hash, key, sizeof(key));
+  fnv1a::hash(hash, &leap_hash, sizeof(leap_hash));
+  fnv1a::hash(hash, &eop_hash, sizeof(eop_hash));
+
+  std::ostringstream name;
+  name << "ecfeci_" << std::hex << std::setw(16) << std::setfill('0') <<
+          hash << ".bin";
+  return name.str();
+}
+
+
+bool EcfEciSys::readCache(const std::string& fname)
+{
+  std::unique_ptr<MappedFile> mf {nullptr};
+  try {
+    mf = std::make_unique<MappedFile>(fname);
+  } catch (const std::runtime_error& re) {
+    return false;
+  }
+  if (mf->size() < sizeof(cache_header)) {
+    return false;
+  }
+
+    // Header must match the time span and sources of this system
+  cache_header hdr;
+  std::memcpy(&hdr, mf->data(), sizeof(hdr));
+  std::uint64_t eop_hash {(m_eopSys == nullptr) ? 0 : m_eopSys->getHash()};
+  if (std::memcmp(hdr.magic, cache_magic, sizeof(cache_magic)) != 0  ||
+      hdr.version != cache_version  ||
+      hdr.ndbl != cache_ndbl  ||
+      hdr.jd_start_high != jdStart.getJdHigh()  ||
+      hdr.jd_start_low != jdStart.getJdLow()  ||
+      hdr.jd_stop_high != jdStop.getJdHigh()  ||
+      hdr.jd_stop_low != jdStop.getJdLow()  ||
+      hdr.rate_days != rate_days  ||
+      hdr.leap_hash != m_leapSeconds->getHash()  ||
+      hdr.eop_hash != eop_hash  ||
+      hdr.nfi != nfi  ||
+      mf->size() != sizeof(hdr) + nfi*cache_ndbl*sizeof(double)) {
+    return false;
+  }
+
+  if (lazy_load) {
+    m_cache = std::move(mf);
+    return true;
+  }
+  const char* rec {mf->data() + sizeof(hdr)};
+  for (unsigned long ii=0UL; ii<nfi; ++ii) {
+    this->readCacheNode(rec, ii);
+  }
+
+  return true;
+}
+
+
+void EcfEciSys::readCacheNode(const char* rec, unsigned long ndx) const
+{
+  double d[cache_ndbl];
+  std::memcpy(d, rec + ndx*sizeof(d), sizeof(d));
+  ecf_eci& f2i = f2iData[ndx];
+  f2i.mjd2000 = d[0];
+  f2i.ut1mutc = d[1];
+  f2i.lod = d[2];
+  f2i.pm = Eigen::Quaterniond(d[3], d[4], d[5], d[6]);
+  f2i.bpn = Eigen::Quaterniond(d[7], d[8], d[9], d[10]);
+  meme_eci& i2i = memeData[ndx];
+  i2i.mjd2000 = d[0];
+  i2i.p76 = Eigen::Quaterniond(d[11], d[12], d[13], d[14]);
+  cipData[ndx] = {d[15], d[16], d[17], d[18], d[19], d[20]};
+}
+
+
+void EcfEciSys::writeCache(const std::string& fname) const
+{
+  cache_header hdr;
+  std::memcpy(hdr.magic, cache_magic, sizeof(cache_magic));
+  hdr.version = cache_version;
+  hdr.ndbl = cache_ndbl;
+  hdr.jd_start_high = jdStart.getJdHigh();
+  hdr.jd_start_low = jdStart.getJdLow();
+  hdr.jd_stop_high = jdStop.getJdHigh();
+  hdr.jd_stop_low = jdStop.getJdLow();
+  hdr.rate_days = rate_days;
+  hdr.leap_hash = m_leapSeconds->getHash();
+  hdr.eop_hash = (m_eopSys == nullptr) ? 0 : m_eopSys->getHash();
+  hdr.nfi = nfi;
+
+    // Write to a unique temporary file and rename so concurrent
+    // processes never read a partially written cache
+  std::ostringstream tmp_name;
+  tmp_name << fname << '.' << std::hex << std::random_device{}();
+  std::ofstream fout(tmp_name.str(), std::ios::binary);
+  if (!fout.is_open()) {
+    return;
+  }
+  fout.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+  for (unsigned long ii=0UL; ii<nfi; ++ii) {
+    const ecf_eci& f2i = f2iData[ii];
+    const meme_eci& i2i = memeData[ii];
+    const cip_pm& cip = cipData[ii];
+    double d[cache_ndbl] {f2i.mjd2000, f2i.ut1mutc, f2i.lod,
+                          f2i.pm.w(), f2i.pm.x(), f2i.pm.y(), f2i.pm.z(),
+                          f2i.bpn.w(), f2i.bpn.x(), f2i.bpn.y(), f2i.bpn.z(),
+                          i2i.p76.w(), i2i.p76.x(), i2i.p76.y(), i2i.p76.z(),
+                          cip.x, cip.y, cip.s, cip.sp, cip.xp, cip.yp};
+    fout.write(reinterpret_cast<const char*>(d), sizeof(d));
+  }
+  fout.close();
+  if (fout.fail()  ||  std::rename(tmp_name.str().c_str(), fname.c_str())) {
+    std::remove(tmp_name.str().c_str());
+  }
+}
+
+
+void EcfEciSys::loadNode(unsigned long ndx) const
+{
+  if (!lazy_load  ||  ndx >= nfi) {
+    return;
+  }
+  unsigned long blk {ndx/block_size};
+  std::call_once(m_block_loaded[blk], [this, blk]() {
+    unsigned long ndx1 {blk*block_size};
+    unsigned long ndx2 {std::min(ndx1 + block_size, nfi)};
+    if (m_cache != nullptr) {
+      const char* rec {m_cache->data() + sizeof(cache_header)};
+      for (unsigned long ii=ndx1; ii<ndx2; ++ii) {
+        this->readCacheNode(rec, ii);
+      }
+    } else {
+      for (unsigned long ii=ndx1; ii<ndx2; ++ii) {
+        this->setNode(ii);
+      }
+    }
+  });
 }
 
 
 ecf_eci EcfEciSys::getEcfEciData(const JulianDate& utc) const
 {
     // Check for valid date
-  double days {utc - jdStart};
-  if (days < 0.0  ||  jdStop - utc < 0.0) {
+  if (utc - jdStart < 0.0  ||  jdStop - utc < 0.0) {
     throw std::out_of_range("EcfEciSys::getEcfEciData() Time out of range");
   }
 
+  return this->interpolate(utc);
+}
+
+
+ecf_eci EcfEciSys::interpolate(const JulianDate& utc) const
+{
     // Always need first index
+  double days {utc - jdStart};
   unsigned long int ndx1 {static_cast<unsigned long int>(days/rate_days)};
+  this->loadNode(ndx1);
   const ecf_eci& f2i1 = f2iData[ndx1];
 
     // Get second data set if interpolating - otherwise,
     // return data less than or equal to requested time
   if (nfi == 1UL) {
     return f2iData[0UL];
+  } else if (interpolate_bpnpm  &&  cheby_cip) {
+    return this->interpolateCip(utc, ndx1);
   } else if (interpolate_bpnpm) {
     double mjd2000 {utc.getMjd2000()};
     double dt_days {mjd2000 - f2i1.mjd2000};
     double dt {dt_days/rate_days};
     unsigned long int ndx2 {ndx1 + 1UL};
+    this->loadNode(ndx2);
     const ecf_eci& f2i2 = f2iData[ndx2];
     double ut1mutc {f2i1.ut1mutc + dt*(f2i2.ut1mutc - f2i1.ut1mutc)};
     double lod {f2i1.lod + dt*(f2i2.lod - f2i1.lod)};
@@ -187,41 +561,213 @@ ecf_eci EcfEciSys::getEcfEciData(const JulianDate& utc) const
 }
 
 
-Eigen::Matrix<double, 3, 1>
-EcfEciSys::ecf2eci(const JulianDate& utc,
-                   const Eigen::Matrix<double, 3, 1>& posf) const
+ecf_eci EcfEciSys::interpolateCip(const JulianDate& utc,
+                                  unsigned long ndx) const
+{
+    // Nodes bracketing the requested time are at the center of the
+    // fit, shifted as needed to remain within the available data
+  unsigned long ndx0 {(ndx > 0UL) ? ndx - 1UL : 0UL};
+  if (ndx0 + cip_nodes > nfi) {
+    ndx0 = nfi - cip_nodes;
+  }
+  for (unsigned long ii=0UL; ii<cip_nodes; ++ii) {
+    this->loadNode(ndx0 + ii);
+  }
+
+    // Weights applied to node values given the normalized time [-1, 1]
+    // of the fit
+  double mjd2000 {utc.getMjd2000()};
+  double dt {2.0*(mjd2000 - f2iData[ndx0].mjd2000)/
+             ((cip_nodes - 1UL)*rate_days) - 1.0};
+  Eigen::Matrix<double, 1, cip_nodes> wts =
+      chebyshev::poly<double, cip_order>(dt)*cip_fit;
+
+    // UT1 - UTC from EOP data steps by a second at a leap second, which
+    // a fit would spread over the nodes with overshoot.  When the fit
+    // spans one, UT1 - TAI is fit instead with TAI - UTC restored after.
+  double tai_utc {0.0};
+  bool leap {false};
+  if (m_eopSys != nullptr) {
+    tai_utc = m_leapSeconds->getTai_Utc(jdNode0 + ndx0*rate_days);
+    leap = m_leapSeconds->getTai_Utc(jdNode0 + (ndx0 + cip_nodes - 1UL)*
+                                     rate_days) != tai_utc;
+  }
+
+  ecf_eci f2i;
+  cip_pm cip;
+  f2i.mjd2000 = mjd2000;
+  for (unsigned long ii=0UL; ii<cip_nodes; ++ii) {
+    const ecf_eci& f2ii = f2iData[ndx0 + ii];
+    const cip_pm& cipi = cipData[ndx0 + ii];
+    double wt {wts(ii)};
+    if (leap) {
+      tai_utc = m_leapSeconds->getTai_Utc(jdNode0 + (ndx0 + ii)*rate_days);
+    }
+    f2i.ut1mutc += wt*(f2ii.ut1mutc - phy_const::tu_per_sec*tai_utc);
+    f2i.lod += wt*f2ii.lod;
+    cip.x += wt*cipi.x;
+    cip.y += wt*cipi.y;
+    cip.s += wt*cipi.s;
+    cip.sp += wt*cipi.sp;
+    cip.xp += wt*cipi.xp;
+    cip.yp += wt*cipi.yp;
+  }
+  if (leap) {
+    tai_utc = m_leapSeconds->getTai_Utc(utc);
+  }
+  f2i.ut1mutc += phy_const::tu_per_sec*tai_utc;
+  cip2quat_direct(cip, f2i.bpn, f2i.pm);
+
+  return f2i;
+}
+
+
+void EcfEciSys::checkRange(const std::vector<JulianDate>& utc,
+                           Eigen::Index ncol, const char* caller) const
+{
+  using namespace std::string_literals;
+  if (static_cast<Eigen::Index>(utc.size()) != ncol) {
+    throw std::invalid_argument("EcfEciSys::"s + caller +
+                                "() Number of times and vectors differ");
+  }
+  for (const auto& jd : utc) {
+    if (jd - jdStart < 0.0  ||  jdStop - jd < 0.0) {
+      throw std::out_of_range("EcfEciSys::"s + caller +
+                              "() Time out of range");
+    }
+  }
+}
+
+
+EcfEciTransform EcfEciSys::getTransform(const JulianDate& utc) const
+{
+  return this->transform(utc, this->getEcfEciData(utc));
+}
+
+
+EcfEciTransform EcfEciSys::transform(const JulianDate& utc,
+                                     const ecf_eci& f2i) const
 {
-  ecf_eci f2i {this->getEcfEciData(utc)};
   auto ut1 {utc + phy_const::day_per_tu*f2i.ut1mutc};
   double era {iauEra00(ut1.getJdHigh(), ut1.getJdLow())};
-  Eigen::Quaterniond qera{Eigen::AngleAxisd(era, Eigen::Vector3d::UnitZ())};
-  return f2i.bpn*qera*f2i.pm*posf;
+  double we {phy_const::earth_angular_velocity(f2i.lod)};
+  return EcfEciTransform(utc, f2i.bpn, era, f2i.pm, we, gmst82_era(ut1));
 }
 
 
-Eigen::Matrix<double, 6, 1>
-EcfEciSys::ecf2eci(const JulianDate& utc,
-                   const Eigen::Matrix<double, 3, 1>& posf,
-                   const Eigen::Matrix<double, 3, 1>& velf) const
+EcfEciTransform EcfEciSys::transform(const JulianDate& utc,
+                                     const ecf_eci& f2i,
+                                     era_phase& era) const
 {
-  ecf_eci f2i {this->getEcfEciData(utc)};
   auto ut1 {utc + phy_const::day_per_tu*f2i.ut1mutc};
-  double era {iauEra00(ut1.getJdHigh(), ut1.getJdLow())};
-  Eigen::Quaterniond qera{Eigen::AngleAxisd(era, Eigen::Vector3d::UnitZ())};
-  Eigen::Matrix<double, 3, 1> pos_tirf = f2i.pm*posf;
-  Eigen::Quaterniond qbpn_era {f2i.bpn*qera};
+  double cera {1.0};
+  double sera {0.0};
+  era.at(ut1, cera, sera);
   double we {phy_const::earth_angular_velocity(f2i.lod)};
-  Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, we};
+  return EcfEciTransform(utc, f2i.bpn, cera, sera, f2i.pm, we,
+                         gmst82_era(ut1));
+}
 
-  Eigen::Matrix<double, 3, 1> posi = qbpn_era*pos_tirf;
-  Eigen::Matrix<double, 3, 1> veli = qbpn_era*(f2i.pm*velf +
-                                               wvec.cross(pos_tirf));
 
-  Eigen::Matrix<double, 6, 1> xeci;
-  xeci.block<3, 1>(0, 0) = posi;
-  xeci.block<3, 1>(3, 0) = veli;
+void EcfEciSys::era_phase::at(const JulianDate& ut1,
+                              double& cera, double& sera)
+{
+  double dera {valid ? era_rate*(ut1 - ut1_0) : 0.0};
+  if (!valid  ||  std::abs(dera) > era_max_step) {
+    double era {iauEra00(ut1.getJdHigh(), ut1.getJdLow())};
+    ut1_0 = ut1;
+    cos_0 = std::cos(era);
+    sin_0 = std::sin(era);
+    valid = true;
+    cera = cos_0;
+    sera = sin_0;
+    return;
+  }
 
-  return xeci;
+    // Series expansion of the increment, truncation error below
+    // double precision for |dera| <= era_max_step
+  double d2 {dera*dera};
+  double cd {1.0 - d2/2.0*(1.0 - d2/12.0*(1.0 - d2/30.0*(1.0 - d2/56.0*
+             (1.0 - d2/90.0*(1.0 - d2/132.0*(1.0 - d2/182.0))))))};
+  double sd {dera*(1.0 - d2/6.0*(1.0 - d2/20.0*(1.0 - d2/42.0*
+             (1.0 - d2/72.0*(1.0 - d2/110.0*(1.0 - d2/156.0))))))};
+  cera = cos_0*cd - sin_0*sd;
+  sera = sin_0*cd + cos_0*sd;
+}
+
+
+std::vector<EcfEciTransform>
+EcfEciSys::getTransforms(const std::vector<JulianDate>& utc) const
+{
+  this->checkRange(utc, static_cast<Eigen::Index>(utc.size()),
+                   "getTransforms");
+
+  std::vector<EcfEciTransform> xfms;
+  xfms.reserve(utc.size());
+  era_phase phase;
+  for (const auto& jd : utc) {
+    xfms.push_back(this->transform(jd, this->interpolate(jd), phase));
+  }
+
+  return xfms;
+}
+
+
+template<typename F>
+void EcfEciSys::convert(const std::vector<JulianDate>& utc, F&& kernel) const
+{
+  f2i_block blk;
+  blk.gmst_era.setZero();
+  blk.cera.setOnes();
+  blk.sera.setZero();
+  era_phase phase;
+  const auto nt = static_cast<Eigen::Index>(utc.size());
+  for (Eigen::Index i0=0; i0<nt; i0+=batch_block) {
+    const Eigen::Index nb {std::min<Eigen::Index>(batch_block, nt - i0)};
+      // Interpolated parameters, scattered by parameter
+    for (Eigen::Index jj=0; jj<nb; ++jj) {
+      const JulianDate& jd = utc[i0 + jj];
+      ecf_eci f2i {this->interpolate(jd)};
+      Eigen::Map<Eigen::Matrix3d>(blk.bpn.col(jj).data()) =
+                                                 f2i.bpn.toRotationMatrix();
+      Eigen::Map<Eigen::Matrix3d>(blk.pm.col(jj).data()) =
+                                                  f2i.pm.toRotationMatrix();
+      auto ut1 {jd + phy_const::day_per_tu*f2i.ut1mutc};
+      phase.at(ut1, blk.cera(jj), blk.sera(jj));
+      blk.gmst_era(jj) = gmst82_era(ut1);
+      blk.we(jj) = phy_const::earth_angular_velocity(f2i.lod);
+    }
+      // GMST from ERA and the small GMST - ERA offset, as with
+      // EcfEciTransform, evaluated over the whole block at once
+    Eigen::Array<double, 1, batch_block> d2 {blk.gmst_era.square()};
+    Eigen::Array<double, 1, batch_block> cd {
+        1.0 - d2/2.0*(1.0 - d2/12.0*(1.0 - d2/30.0*(1.0 - d2/56.0)))};
+    Eigen::Array<double, 1, batch_block> sd {
+        blk.gmst_era*(1.0 - d2/6.0*(1.0 - d2/20.0*(1.0 - d2/42.0)))};
+    blk.cgst = blk.cera*cd - blk.sera*sd;
+    blk.sgst = blk.sera*cd + blk.cera*sd;
+
+    for (Eigen::Index jj=0; jj<nb; ++jj) {
+      kernel(i0 + jj, blk, jj);
+    }
+  }
+}
+
+
+Eigen::Matrix<double, 3, 1>
+EcfEciSys::ecf2eci(const JulianDate& utc,
+                   const Eigen::Matrix<double, 3, 1>& posf) const
+{
+  return this->getTransform(utc).ecf2eci(posf);
+}
+
+
+Eigen::Matrix<double, 6, 1>
+EcfEciSys::ecf2eci(const JulianDate& utc,
+                   const Eigen::Matrix<double, 3, 1>& posf,
+                   const Eigen::Matrix<double, 3, 1>& velf) const
+{
+  return this->getTransform(utc).ecf2eci(posf, velf);
 }
 
 
@@ -251,11 +797,7 @@ Eigen::Matrix<double, 3, 1>
 EcfEciSys::eci2ecf(const JulianDate& utc,
                   const Eigen::Matrix<double, 3, 1>& posi) const
 {
-  ecf_eci f2i {this->getEcfEciData(utc)};
-  auto ut1 {utc + phy_const::day_per_tu*f2i.ut1mutc};
-  double era {iauEra00(ut1.getJdHigh(), ut1.getJdLow())};
-  Eigen::Quaterniond qera{Eigen::AngleAxisd(-era, Eigen::Vector3d::UnitZ())};
-  return f2i.pm.conjugate()*qera*f2i.bpn.conjugate()*posi;
+  return this->getTransform(utc).eci2ecf(posi);
 }
 
 
@@ -264,48 +806,112 @@ EcfEciSys::eci2ecf(const JulianDate& utc,
                    const Eigen::Matrix<double, 3, 1>& posi,
                    const Eigen::Matrix<double, 3, 1>& veli) const
 {
-  ecf_eci f2i {this->getEcfEciData(utc)};
-  auto ut1 {utc + phy_const::day_per_tu*f2i.ut1mutc};
-  double era {iauEra00(ut1.getJdHigh(), ut1.getJdLow())};
-  Eigen::Quaterniond qera{Eigen::AngleAxisd(-era, Eigen::Vector3d::UnitZ())};
-  Eigen::Quaterniond qera_bpnt {qera*f2i.bpn.conjugate()};
-  Eigen::Matrix<double, 3, 1> pos_tirf = qera_bpnt*posi;
-  double we {phy_const::earth_angular_velocity(f2i.lod)};
-  Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, we};
+  return this->getTransform(utc).eci2ecf(posi, veli);
+}
+
 
-  Eigen::Matrix<double, 3, 1> posf = f2i.pm.conjugate()*pos_tirf;
-  Eigen::Matrix<double, 3, 1> velf = f2i.pm.conjugate()*(qera_bpnt*veli -
-                                                         wvec.cross(pos_tirf));
-  
-  Eigen::Matrix<double, 6, 1> xecf;
-  xecf.block<3, 1>(0, 0) = posf;
-  xecf.block<3, 1>(3, 0) = velf;
+Eigen::Matrix<double, 3, Eigen::Dynamic>
+EcfEciSys::ecf2eci(const std::vector<JulianDate>& utc,
+                   const Eigen::Matrix<double, 3, Eigen::Dynamic>& posf) const
+{
+  this->checkRange(utc, posf.cols(), "ecf2eci");
+  Eigen::Matrix<double, 3, Eigen::Dynamic> posi(3, posf.cols());
+  this->convert(utc, [&posf, &posi](Eigen::Index ii,
+                                    const f2i_block& blk, Eigen::Index jj) {
+    Eigen::Matrix<double, 3, 1> pos_tirf = blk.pmAt(jj)*posf.col(ii);
+    posi.col(ii) = blk.bpnAt(jj)*rz(blk.cera(jj), blk.sera(jj), pos_tirf);
+  });
+
+  return posi;
+}
+
+
+Eigen::Matrix<double, 6, Eigen::Dynamic>
+EcfEciSys::ecf2eci(const std::vector<JulianDate>& utc,
+                   const Eigen::Matrix<double, 6, Eigen::Dynamic>& xecf) const
+{
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xeci(6, xecf.cols());
+  this->ecf2eci(utc, xecf, xeci);
+
+  return xeci;
+}
+
+
+void EcfEciSys::ecf2eci(const std::vector<JulianDate>& utc,
+    const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xecf,
+    Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xeci) const
+{
+  this->checkRange(utc, xecf.cols(), "ecf2eci");
+  check_output(xecf.cols(), xeci.cols(), "ecf2eci");
+  this->convert(utc, [&xecf, &xeci](Eigen::Index ii,
+                                    const f2i_block& blk, Eigen::Index jj) {
+    Eigen::Matrix<double, 3, 1> pos_tirf = blk.pmAt(jj)*xecf.block<3,1>(0,ii);
+    Eigen::Matrix<double, 3, 1> vel_tirf = blk.pmAt(jj)*xecf.block<3,1>(3,ii) +
+                                           wcross(blk.we(jj), pos_tirf);
+    xeci.block<3,1>(0,ii) = blk.bpnAt(jj)*rz(blk.cera(jj), blk.sera(jj),
+                                             pos_tirf);
+    xeci.block<3,1>(3,ii) = blk.bpnAt(jj)*rz(blk.cera(jj), blk.sera(jj),
+                                             vel_tirf);
+  });
+}
+
+
+Eigen::Matrix<double, 3, Eigen::Dynamic>
+EcfEciSys::eci2ecf(const std::vector<JulianDate>& utc,
+                   const Eigen::Matrix<double, 3, Eigen::Dynamic>& posi) const
+{
+  this->checkRange(utc, posi.cols(), "eci2ecf");
+  Eigen::Matrix<double, 3, Eigen::Dynamic> posf(3, posi.cols());
+  this->convert(utc, [&posi, &posf](Eigen::Index ii,
+                                    const f2i_block& blk, Eigen::Index jj) {
+    Eigen::Matrix<double, 3, 1> pos_tirf =
+        rzt(blk.cera(jj), blk.sera(jj),
+            blk.bpnAt(jj).transpose()*posi.col(ii));
+    posf.col(ii) = blk.pmAt(jj).transpose()*pos_tirf;
+  });
+
+  return posf;
+}
+
+
+Eigen::Matrix<double, 6, Eigen::Dynamic>
+EcfEciSys::eci2ecf(const std::vector<JulianDate>& utc,
+                   const Eigen::Matrix<double, 6, Eigen::Dynamic>& xeci) const
+{
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xecf(6, xeci.cols());
+  this->eci2ecf(utc, xeci, xecf);
 
   return xecf;
 }
 
 
+void EcfEciSys::eci2ecf(const std::vector<JulianDate>& utc,
+    const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xeci,
+    Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xecf) const
+{
+  this->checkRange(utc, xeci.cols(), "eci2ecf");
+  check_output(xeci.cols(), xecf.cols(), "eci2ecf");
+  this->convert(utc, [&xeci, &xecf](Eigen::Index ii,
+                                    const f2i_block& blk, Eigen::Index jj) {
+    Eigen::Matrix<double, 3, 1> pos_tirf =
+        rzt(blk.cera(jj), blk.sera(jj),
+            blk.bpnAt(jj).transpose()*xeci.block<3,1>(0,ii));
+    Eigen::Matrix<double, 3, 1> vel_tirf =
+        rzt(blk.cera(jj), blk.sera(jj),
+            blk.bpnAt(jj).transpose()*xeci.block<3,1>(3,ii)) -
+        wcross(blk.we(jj), pos_tirf);
+    xecf.block<3,1>(0,ii) = blk.pmAt(jj).transpose()*pos_tirf;
+    xecf.block<3,1>(3,ii) = blk.pmAt(jj).transpose()*vel_tirf;
+  });
+}
+
+
 Eigen::Matrix<double, 6, 1>
 EcfEciSys::ecf2teme(const JulianDate& utc,
                     const Eigen::Matrix<double, 3, 1>& posf,
                     const Eigen::Matrix<double, 3, 1>& velf) const
 {
-  ecf_eci f2i {this->getEcfEciData(utc)};
-  auto ut1 {utc + phy_const::day_per_tu*f2i.ut1mutc};
-  double gmst {iauGmst82(ut1.getJdHigh(), ut1.getJdLow())};
-  Eigen::Quaterniond qgmst{Eigen::AngleAxisd(gmst, Eigen::Vector3d::UnitZ())};
-  Eigen::Matrix<double, 3, 1> pos_tirf = f2i.pm*posf;
-  double we {phy_const::earth_angular_velocity(f2i.lod)};
-  Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, we};
-
-  Eigen::Matrix<double, 3, 1> posi = qgmst*pos_tirf;
-  Eigen::Matrix<double, 3, 1> veli = qgmst*(f2i.pm*velf + wvec.cross(pos_tirf));
-
-  Eigen::Matrix<double, 6, 1> xeci;
-  xeci.block<3, 1>(0, 0) = posi;
-  xeci.block<3, 1>(3, 0) = veli;
-
-  return xeci;
+  return this->getTransform(utc).ecf2teme(posf, velf);
 }
 
 
@@ -314,23 +920,7 @@ EcfEciSys::teme2ecf(const JulianDate& utc,
                     const Eigen::Matrix<double, 3, 1>& posi,
                     const Eigen::Matrix<double, 3, 1>& veli) const
 {
-  ecf_eci f2i {this->getEcfEciData(utc)};
-  auto ut1 {utc + phy_const::day_per_tu*f2i.ut1mutc};
-  double gmst {iauGmst82(ut1.getJdHigh(), ut1.getJdLow())};
-  Eigen::Quaterniond qgmst{Eigen::AngleAxisd(-gmst, Eigen::Vector3d::UnitZ())};
-  Eigen::Matrix<double, 3, 1> pos_tirf = qgmst*posi;
-  double we {phy_const::earth_angular_velocity(f2i.lod)};
-  Eigen::Matrix<double, 3, 1> wvec {0.0, 0.0, we};
-
-  Eigen::Matrix<double, 3, 1> posf = f2i.pm.conjugate()*pos_tirf;
-  Eigen::Matrix<double, 3, 1> velf = f2i.pm.conjugate()*(qgmst*veli -
-                                                         wvec.cross(pos_tirf));
-  
-  Eigen::Matrix<double, 6, 1> xecf;
-  xecf.block<3, 1>(0, 0) = posf;
-  xecf.block<3, 1>(3, 0) = velf;
-
-  return xecf;
+  return this->getTransform(utc).teme2ecf(posi, veli);
 }
 
 
@@ -338,13 +928,112 @@ Eigen::Matrix<double, 3, 1>
 EcfEciSys::teme2ecf(const JulianDate& utc,
                     const Eigen::Matrix<double, 3, 1>& posi) const
 {
-  ecf_eci f2i {this->getEcfEciData(utc)};
-  auto ut1 {utc + phy_const::day_per_tu*f2i.ut1mutc};
-  double gmst {iauGmst82(ut1.getJdHigh(), ut1.getJdLow())};
-  Eigen::Quaterniond qgmst{Eigen::AngleAxisd(-gmst, Eigen::Vector3d::UnitZ())};
-  Eigen::Matrix<double, 3, 1> pos_tirf = qgmst*posi;
+  return this->getTransform(utc).teme2ecf(posi);
+}
+
+
+Eigen::Matrix<double, 6, Eigen::Dynamic>
+EcfEciSys::teme2ecf(const std::vector<JulianDate>& utc,
+                    const Eigen::Matrix<double, 6, Eigen::Dynamic>& xteme) const
+{
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xecf(6, xteme.cols());
+  this->teme2ecf(utc, xteme, xecf);
 
-  return f2i.pm.conjugate()*pos_tirf;
+  return xecf;
+}
+
+
+void EcfEciSys::teme2ecf(const std::vector<JulianDate>& utc,
+    const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xteme,
+    Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xecf) const
+{
+  this->checkRange(utc, xteme.cols(), "teme2ecf");
+  check_output(xteme.cols(), xecf.cols(), "teme2ecf");
+  this->convert(utc, [&xteme, &xecf](Eigen::Index ii,
+                                     const f2i_block& blk, Eigen::Index jj) {
+    Eigen::Matrix<double, 3, 1> pos_tirf =
+        rzt(blk.cgst(jj), blk.sgst(jj), xteme.block<3,1>(0,ii));
+    Eigen::Matrix<double, 3, 1> vel_tirf =
+        rzt(blk.cgst(jj), blk.sgst(jj), xteme.block<3,1>(3,ii)) -
+        wcross(blk.we(jj), pos_tirf);
+    xecf.block<3,1>(0,ii) = blk.pmAt(jj).transpose()*pos_tirf;
+    xecf.block<3,1>(3,ii) = blk.pmAt(jj).transpose()*vel_tirf;
+  });
+}
+
+
+Eigen::Matrix<double, 3, Eigen::Dynamic>
+EcfEciSys::teme2ecf(const std::vector<JulianDate>& utc,
+                    const Eigen::Matrix<double, 3, Eigen::Dynamic>& pteme) const
+{
+  this->checkRange(utc, pteme.cols(), "teme2ecf");
+  Eigen::Matrix<double, 3, Eigen::Dynamic> posf(3, pteme.cols());
+  this->convert(utc, [&pteme, &posf](Eigen::Index ii,
+                                     const f2i_block& blk, Eigen::Index jj) {
+    posf.col(ii) = blk.pmAt(jj).transpose()*
+                   rzt(blk.cgst(jj), blk.sgst(jj), pteme.col(ii));
+  });
+
+  return posf;
+}
+
+
+Eigen::Matrix<double, 6, Eigen::Dynamic>
+EcfEciSys::ecf2teme(const std::vector<JulianDate>& utc,
+                    const Eigen::Matrix<double, 6, Eigen::Dynamic>& xecf) const
+{
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xteme(6, xecf.cols());
+  this->ecf2teme(utc, xecf, xteme);
+
+  return xteme;
+}
+
+
+void EcfEciSys::ecf2teme(const std::vector<JulianDate>& utc,
+    const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xecf,
+    Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xteme) const
+{
+  this->checkRange(utc, xecf.cols(), "ecf2teme");
+  check_output(xecf.cols(), xteme.cols(), "ecf2teme");
+  this->convert(utc, [&xecf, &xteme](Eigen::Index ii,
+                                     const f2i_block& blk, Eigen::Index jj) {
+    Eigen::Matrix<double, 3, 1> pos_tirf = blk.pmAt(jj)*xecf.block<3,1>(0,ii);
+    Eigen::Matrix<double, 3, 1> vel_tirf = blk.pmAt(jj)*xecf.block<3,1>(3,ii) +
+                                           wcross(blk.we(jj), pos_tirf);
+    xteme.block<3,1>(0,ii) = rz(blk.cgst(jj), blk.sgst(jj), pos_tirf);
+    xteme.block<3,1>(3,ii) = rz(blk.cgst(jj), blk.sgst(jj), vel_tirf);
+  });
+}
+
+
+Eigen::Matrix<double, 6, Eigen::Dynamic>
+EcfEciSys::teme2eci(const std::vector<JulianDate>& utc,
+                    const Eigen::Matrix<double, 6, Eigen::Dynamic>& xteme) const
+{
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xeci(6, xteme.cols());
+  this->teme2eci(utc, xteme, xeci);
+
+  return xeci;
+}
+
+
+void EcfEciSys::teme2eci(const std::vector<JulianDate>& utc,
+    const Eigen::Ref<const Eigen::Matrix<double, 6, Eigen::Dynamic>>& xteme,
+    Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xeci) const
+{
+  this->checkRange(utc, xteme.cols(), "teme2eci");
+  check_output(xteme.cols(), xeci.cols(), "teme2eci");
+  this->convert(utc, [&xteme, &xeci](Eigen::Index ii,
+                                     const f2i_block& blk, Eigen::Index jj) {
+    Eigen::Matrix<double, 3, 1> pos_cirf =
+        rz(blk.cera(jj), blk.sera(jj),
+           rzt(blk.cgst(jj), blk.sgst(jj), xteme.block<3,1>(0,ii)));
+    Eigen::Matrix<double, 3, 1> vel_cirf =
+        rz(blk.cera(jj), blk.sera(jj),
+           rzt(blk.cgst(jj), blk.sgst(jj), xteme.block<3,1>(3,ii)));
+    xeci.block<3,1>(0,ii) = blk.bpnAt(jj)*pos_cirf;
+    xeci.block<3,1>(3,ii) = blk.bpnAt(jj)*vel_cirf;
+  });
 }
 
 
@@ -360,6 +1049,7 @@ EcfEciSys::mod2eci(const JulianDate& utc,
 
     // Always need first index
   unsigned long int ndx1 {static_cast<unsigned long int>(days/rate_days)};
+  this->loadNode(ndx1);
   const meme_eci& i2i1 = memeData[ndx1];
 
     // Get second data set if interpolating - otherwise,
@@ -371,6 +1061,7 @@ EcfEciSys::mod2eci(const JulianDate& utc,
     double dt_days {mjd2000 - i2i1.mjd2000};
     double dt {dt_days/rate_days};
     unsigned long int ndx2 {ndx1 + 1UL};
+    this->loadNode(ndx2);
     const meme_eci& i2i2 = memeData[ndx2];
     Eigen::Quaterniond p76 {i2i1.p76.slerp(dt, i2i2.p76)};
     return bt*p76*mod;
@@ -411,3 +1102,22 @@ static Eigen::Matrix3d from3x3(double mtx[3][3])
 
   return emtx;
 }
+
+
+static void cip2quat(const eom::cip_pm& cip,
+                     Eigen::Quaterniond& bpn, Eigen::Quaterniond& pm)
+{
+  double cirf2gcrf[3][3];         // CIRF to GCRF
+  double itrf2tirf[3][3];         // ITRF to TIRF
+    // Transpose of BPN, to BPN
+  iauC2ixys(cip.x, cip.y, cip.s, cirf2gcrf); 
+  iauTr(cirf2gcrf, cirf2gcrf);
+    // Polar motion, ECF to ECI after transpose
+  iauPom00(cip.xp, cip.yp, cip.sp, itrf2tirf);
+  iauTr(itrf2tirf, itrf2tirf);
+    // Convert to final form
+  Eigen::Matrix3d mbpn = from3x3(cirf2gcrf);
+  Eigen::Matrix3d mpm = from3x3(itrf2tirf);
+  bpn = Eigen::Quaterniond(mbpn);
+  pm = Eigen::Quaterniond(mpm);
+}
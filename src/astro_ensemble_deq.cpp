@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_ensemble_deq.h>
+
+#include <utility>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include <cal_julian_date.h>
+#include <mth_ode.h>
+#include <astro_ecfeci_cursor.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_gravity_std_batch.h>
+
+namespace eom {
+
+
+EnsembleDeq::EnsembleDeq(std::unique_ptr<GravityStdBatch> grav,
+                         std::shared_ptr<const EcfEciSys> ecfeci) :
+                                                   m_f2i_cursor {ecfeci}
+{
+  m_ecfeci = std::move(ecfeci);
+  m_grav = std::move(grav);
+  m_posf.resize(3, m_grav->getLanes());
+  m_accf.resize(3, m_grav->getLanes());
+  m_acci.resize(3, m_grav->getLanes());
+}
+
+
+void EnsembleDeq::getXdot(const JulianDate& utc,
+                          const Eigen::Matrix<double, 6, Eigen::Dynamic>& x,
+                          Eigen::Matrix<double, 6, Eigen::Dynamic>& xdot,
+                          OdeEvalMethod method)
+{
+  const Eigen::Index nm {m_posf.cols()};
+  if (x.cols() != nm  ||  xdot.cols() != nm) {
+    throw std::invalid_argument("EnsembleDeq::getXdot() "
+                                "One column per ensemble member required");
+  }
+
+    // Single ECF/ECI lookup shared by all members
+  EcfEciTransform f2i {m_f2i_cursor.getTransform(utc)};
+
+    // Central body gravity model
+  for (Eigen::Index ii=0; ii<nm; ++ii) {
+    m_posf.col(ii) = f2i.eci2ecf(x.block<3,1>(0,ii));
+  }
+  m_grav->getAccelerations(m_posf, method, m_accf);
+
+    // Velocity is derivative of position, acceleration components
+    // transformed to ECI
+  xdot.topRows<3>() = x.bottomRows<3>();
+  for (Eigen::Index ii=0; ii<nm; ++ii) {
+    xdot.block<3,1>(3,ii) = f2i.ecf2eci(m_accf.col(ii));
+  }
+
+    // Add non-central body accelerations
+  if (m_fmodels.size() > 0) {
+    m_acci.setZero();
+    for (auto& fm : m_fmodels) {
+      fm->getAccelerations(utc, x, m_acci);
+    }
+    xdot.bottomRows<3>() += m_acci;
+  }
+}
+
+
+void EnsembleDeq::addForceModel(std::unique_ptr<ForceModel> fm)
+{
+  m_fmodels.push_back(std::move(fm));
+}
+
+
+}
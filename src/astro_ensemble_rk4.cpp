@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_ensemble_rk4.h>
+
+#include <utility>
+#include <memory>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <mth_ode.h>
+#include <astro_ensemble_deq.h>
+
+namespace eom {
+
+
+EnsembleRk4::EnsembleRk4(std::unique_ptr<EnsembleDeq> deq,
+                         const Duration& dt,
+                         const JulianDate& jd,
+                         const Eigen::Matrix<double, 6, Eigen::Dynamic>& x)
+{
+  if (x.cols() != deq->getMembers()) {
+    throw std::invalid_argument("EnsembleRk4::EnsembleRk4() "
+                                "One column per ensemble member required");
+  }
+  m_deq = std::move(deq);
+  m_dt = dt;
+  m_jd = jd;
+  m_x = x;
+    // Default integration step size if not explicitly set
+  if (m_dt.getTu() == 0.0) {
+    Duration dt_default(0.3, phy_const::tu_per_min);
+    m_dt = dt_default;
+  }
+  const Eigen::Index nm {m_x.cols()};
+  m_dx.resize(6, nm);
+  m_x0.resize(6, nm);
+  m_xd.resize(6, nm);
+  m_xx.resize(6, nm);
+  m_xa.resize(6, nm);
+  m_q.resize(6, nm);
+    // Accelerations at jd
+  m_deq->getXdot(m_jd, m_x, m_dx);
+}
+
+
+JulianDate EnsembleRk4::step()
+{
+  constexpr double half {0.5};
+  constexpr double sixth {1.0/6.0};
+  const double dt_tu {m_dt.getTu()};
+
+    // Same sequence of operations as rk4_step()
+  m_x0 = m_x;
+    // first
+  JulianDate tmpTime {m_jd};
+  m_deq->getXdot(tmpTime, m_x0, m_xd);
+  m_xa = dt_tu*m_xd;
+  m_xx = half*m_xa + m_x0;
+    // second
+  tmpTime += m_dt*half;
+  m_deq->getXdot(tmpTime, m_xx, m_xd);
+  m_q = dt_tu*m_xd;
+  m_xx = m_x0 + half*m_q;
+  m_xa += m_q + m_q;
+    // third
+  m_deq->getXdot(tmpTime, m_xx, m_xd);
+  m_q = dt_tu*m_xd;
+  m_xx = m_x0 + m_q;
+  m_xa += m_q + m_q;
+    // forth
+  m_jd += m_dt;
+  m_deq->getXdot(m_jd, m_xx, m_dx);
+  m_x = m_x0 + (m_xa + dt_tu*m_dx)*sixth;
+  m_deq->getXdot(m_jd, m_x, m_dx, OdeEvalMethod::corrector);
+
+  return m_jd;
+}
+
+
+}
@@ -8,41 +8,216 @@
 
 #include <astro_eop_sys.h>
 
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <random>
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <system_error>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 #include <stdexcept>
 
 #include <Eigen/Dense>
 
+#include <utl_hash.h>
+#include <utl_mapped_file.h>
 #include <cal_const.h>
 #include <cal_julian_date.h>
 
 namespace {
   constexpr double nsec {1.0e-9*cal_const::day_per_sec};
+
+    // Binary cache file identification and format version
+  constexpr char cache_magic[8] {'E', 'O', 'M', 'E', 'O', 'P', '\0', '\0'};
+  constexpr std::uint32_t cache_version {1};
+
+    // Cache file header - identifies the source file, followed by the
+    // MJD of the first record and the number of daily records
+  struct cache_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t rec_size;
+    std::uint64_t src_size;
+    std::int64_t src_mtime;
+    std::int64_t mjd0;
+    std::uint64_t nrec;
+  };
+
+    // Cache record - MJD implied by position
+  struct cache_record {
+    double xp;
+    double yp;
+    double ut1mutc;
+    double lod;
+    double dx;
+    double dy;
+  };
+
+    // Column indices of values of interest within a record
+  struct eop_columns {
+    unsigned int xp;
+    unsigned int yp;
+    unsigned int ut1mutc;
+    unsigned int lod;
+    unsigned int dx;
+    unsigned int dy;
+  };
+
+    // Start of the line following the one containing p, or end
+  const char* next_line(const char* p, const char* end)
+  {
+    const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+    return (nl == nullptr) ? end : nl + 1;
+  }
+
+    // MJD of the record starting at line - false if not a record
+  bool line_mjd(const char* line, const char* end, long& mjd)
+  {
+    auto [ptr, ec] = std::from_chars(line, end, mjd);
+    return ec == std::errc()  &&  (ptr == end  ||  *ptr == ';');
+  }
+
+    // Parses a single ';' delimited field, skipping leading white
+    // space and sign as std::stod() does.  Returns false, leaving val
+    // unchanged, if the field is empty or invalid.
+  bool parse_field(const char* first, const char* last, double& val)
+  {
+    while (first < last  &&  std::isspace(static_cast<unsigned char>(*first))) {
+      ++first;
+    }
+    if (last - first > 1  &&  *first == '+'  &&  first[1] != '-') {
+      ++first;
+    }
+    double tmp {0.0};
+    auto [ptr, ec] = std::from_chars(first, last, tmp);
+    if (ec != std::errc()  ||  ptr == first) {
+      return false;
+    }
+    val = tmp;
+    return true;
+  }
+
+    // Parse the record starting at line - MJD is the first column.
+    // Values are parsed in the same groups as the original stream
+    // based parser:  polar motion and UT1-UTC, LOD, and then the
+    // celestial pole offsets, with parsing of a group stopping at the
+    // first empty or invalid field.
+  eom::eop_record parse_record(const char* line, const char* end,
+                               const eop_columns& cols)
+  {
+    const char* eol = next_line(line, end);
+    while (eol > line  &&  (eol[-1] == '\n'  ||  eol[-1] == '\r')) {
+      --eol;
+    }
+    eom::eop_record eop;
+    line_mjd(line, eol, eop.mjd);
+      // Locate fields of interest - missing fields are empty
+    std::pair<const char*, const char*> xp {eol, eol};
+    std::pair<const char*, const char*> yp {eol, eol};
+    std::pair<const char*, const char*> ut1mutc {eol, eol};
+    std::pair<const char*, const char*> lod {eol, eol};
+    std::pair<const char*, const char*> dx {eol, eol};
+    std::pair<const char*, const char*> dy {eol, eol};
+    unsigned int col {0};
+    const char* field {line};
+    while (field < eol) {
+      const char* delim = static_cast<const char*>(
+          std::memchr(field, ';', eol - field));
+      const char* last = (delim == nullptr) ? eol : delim;
+      if (col == cols.xp) {
+        xp = {field, last};
+      } else if (col == cols.yp) {
+        yp = {field, last};
+      } else if (col == cols.ut1mutc) {
+        ut1mutc = {field, last};
+      } else if (col == cols.lod) {
+        lod = {field, last};
+      } else if (col == cols.dx) {
+        dx = {field, last};
+      } else if (col == cols.dy) {
+        dy = {field, last};
+      }
+      if (delim == nullptr) {
+        break;
+      }
+      field = delim + 1;
+      ++col;
+    }
+    if (parse_field(xp.first, xp.second, eop.xp)  &&
+        parse_field(yp.first, yp.second, eop.yp)) {
+      parse_field(ut1mutc.first, ut1mutc.second, eop.ut1mutc);
+    }
+    parse_field(lod.first, lod.second, eop.lod);
+    if (parse_field(dx.first, dx.second, eop.dx)) {
+      parse_field(dy.first, dy.second, eop.dy);
+    }
+    return eop;
+  }
 }
 
 namespace eom {
 
 EopSys::EopSys(std::string fname,
-         const JulianDate& startTime, const JulianDate& stopTime)
+               const JulianDate& startTime, const JulianDate& stopTime,
+               const std::string& cache_dir)
 {
     // Pad by an extra day for interpolation options
-  mjd_first = static_cast<unsigned int>(startTime.getMjd() - 1.0);
-  mjd_last = static_cast<unsigned int>(stopTime.getMjd() + 1.0);
+  mjd_first = static_cast<unsigned long>(startTime.getMjd() - 1.0);
+  mjd_last = static_cast<unsigned long>(stopTime.getMjd() + 1.0);
+
+  std::string cache_file {""};
+  if (!cache_dir.empty()) {
+    cache_file = cache_dir + "/" + this->cacheName(fname);
+  }
+  if (cache_file.empty()  ||  !this->readCache(cache_file, fname)) {
+    this->parse(fname, cache_file);
+  }
 
-    // Open IERS EOP file
-  std::ifstream ifs(fname);
-  if (!ifs.is_open()) {
+    // Fields hashed individually to avoid struct padding
+  m_hash = fnv1a::offset;
+  for (const auto& eop : eopData) {
+    fnv1a::hash(m_hash, &eop.mjd, sizeof(eop.mjd));
+    fnv1a::hash(m_hash, &eop.xp, sizeof(eop.xp));
+    fnv1a::hash(m_hash, &eop.yp, sizeof(eop.yp));
+    fnv1a::hash(m_hash, &eop.ut1mutc, sizeof(eop.ut1mutc));
+    fnv1a::hash(m_hash, &eop.lod, sizeof(eop.lod));
+    fnv1a::hash(m_hash, &eop.dx, sizeof(eop.dx));
+    fnv1a::hash(m_hash, &eop.dy, sizeof(eop.dy));
+  }
+}
+
+
+void EopSys::parse(const std::string& fname, const std::string& cache_file)
+{
+    // Map IERS EOP file
+  std::unique_ptr<MappedFile> mf {nullptr};
+  try {
+    mf = std::make_unique<MappedFile>(fname);
+  } catch (const std::runtime_error& re) {
     throw std::runtime_error("EopSys::EopSys() Can't open " + fname);
   }
+  const char* begin {mf->data()};
+  const char* end {begin + mf->size()};
+
    // Collect column labels
   std::unordered_map<std::string, unsigned int> col_labels;
-  std::string input_line;
-  if (std::getline(ifs, input_line)) {
-    std::stringstream header_stream(input_line);
+  const char* data_begin {next_line(begin, end)};
+  {
+    const char* eol {data_begin};
+    while (eol > begin  &&  (eol[-1] == '\n'  ||  eol[-1] == '\r')) {
+      --eol;
+    }
+    std::stringstream header_stream(std::string(begin, eol));
     std::string token;
     unsigned int ndx {0};
     while (std::getline(header_stream, token, ';')) {
@@ -51,83 +226,206 @@ EopSys::EopSys(std::string fname,
   }
     // Resolve columns of interest
   unsigned int mjd_ndx;
-  unsigned int xp_ndx;
-  unsigned int yp_ndx;
-  unsigned int ut1mutc_ndx;
-  unsigned int lod_ndx;
-  unsigned int dx_ndx;
-  unsigned int dy_ndx;
+  eop_columns cols;
   try {
     mjd_ndx = col_labels.at("MJD");
-    xp_ndx = col_labels.at("x_pole");
-    yp_ndx = col_labels.at("y_pole");
-    ut1mutc_ndx = col_labels.at("UT1-UTC");
-    lod_ndx = col_labels.at("LOD");
-    dx_ndx = col_labels.at("dX");
-    dy_ndx = col_labels.at("dY");
+    cols.xp = col_labels.at("x_pole");
+    cols.yp = col_labels.at("y_pole");
+    cols.ut1mutc = col_labels.at("UT1-UTC");
+    cols.lod = col_labels.at("LOD");
+    cols.dx = col_labels.at("dX");
+    cols.dy = col_labels.at("dY");
   } catch (const std::out_of_range& oor) {
     throw std::runtime_error("EopSys::EopSys() Bad EOP file headers");
   }
 
-    // Force assumption of MJD being first to speed locating proper
-    // in IERS EOP file (not necessary given map, but speeds things up).
+    // Force assumption of MJD being first to allow locating records
+    // by binary search of the file contents
   if (mjd_ndx != 0) {
     throw std::runtime_error("EopSys::EopSys MJD expected to be first column");
   }
 
-    // Locate first line and then read data
-  unsigned long mjd {0};
-  std::string token;
-  bool found_start {false};
-  bool done {false};
-  while (!done  &&  std::getline(ifs,input_line)) {
-    std::stringstream eop_stream(input_line);
-    if (std::getline(eop_stream, token, ';')) {
-      mjd = std::stol(token);
-      if (mjd == mjd_first) {
-        found_start = true;
+    // When caching, all records are parsed and stored.  Otherwise,
+    // binary search for the first record of interest, relying on
+    // monotonically increasing MJD values.
+  const char* line {data_begin};
+  if (cache_file.empty()) {
+    const char* lo {data_begin};
+    const char* hi {end};
+    while (lo < hi) {
+      const char* mid {lo + (hi - lo)/2};
+      const char* mid_line {mid};
+      while (mid_line > lo  &&  mid_line[-1] != '\n') {
+        --mid_line;
       }
-      if (mjd == mjd_last) {
-        done = true;
+      long mjd {0};
+      if (line_mjd(mid_line, end, mjd)  &&
+          mjd < static_cast<long>(mjd_first)) {
+        lo = next_line(mid_line, end);
+      } else {
+        hi = mid_line;
       }
     }
-    if (found_start) {
-      eop_record eop; 
-      eop.mjd = mjd;
-      std::vector<std::string> eop_tokens;
-      eop_tokens.push_back("");
-      while (std::getline(eop_stream, token, ';')) {
-        eop_tokens.push_back(token);
-      }
-        // Parse available data - default to zero if "" string.
-      try {
-        eop.xp = std::stod(eop_tokens[xp_ndx]);
-        eop.yp = std::stod(eop_tokens[yp_ndx]);
-        eop.ut1mutc = std::stod(eop_tokens[ut1mutc_ndx]);
-      } catch (const std::invalid_argument& ex) {
-        ;
-      }
-      try {
-        eop.lod = std::stod(eop_tokens[lod_ndx]);
-      } catch (const std::invalid_argument& ex) {
-        ;
-      }
-      try {
-        eop.dx = std::stod(eop_tokens[dx_ndx]);
-        eop.dy = std::stod(eop_tokens[dy_ndx]);
-      } catch (const std::invalid_argument& ex) {
-        ;
-      }
-      eopData.push_back(eop);
+    line = lo;
+  }
+
+  std::vector<eop_record> records;
+  for (; line < end; line = next_line(line, end)) {
+    long mjd {0};
+    if (!line_mjd(line, end, mjd)) {
+      continue;
+    }
+    if (!records.empty()  &&  mjd != records.back().mjd + 1L) {
+      throw std::runtime_error("EopSys::EopSys() Records not daily at MJD " +
+                               std::to_string(mjd));
+    }
+    records.push_back(parse_record(line, end, cols));
+    if (cache_file.empty()  &&  mjd == static_cast<long>(mjd_last)) {
+      break;
     }
   }
 
-  if (!found_start) {
+  if (!cache_file.empty()) {
+    this->writeCache(cache_file, fname, records);
+  }
+  this->setSpan(records);
+}
+
+
+void EopSys::setSpan(const std::vector<eop_record>& records)
+{
+  long mjd0 {records.empty() ? 0L : records.front().mjd};
+  long first {static_cast<long>(mjd_first) - mjd0};
+  long last {static_cast<long>(mjd_last) - mjd0};
+  if (records.empty()  ||  first < 0L  ||
+      first >= static_cast<long>(records.size())) {
     throw std::runtime_error("EopSys::EopSys() Can't find start MJD ");
-  } else if (!done) {
+  } else if (last >= static_cast<long>(records.size())) {
     throw std::runtime_error("EopSys::EopSys() Can't find end MJD ");
   }
+  eopData.assign(records.begin() + first, records.begin() + last + 1L);
+}
+
+
+std::string EopSys::cacheName(const std::string& fname) const
+{
+    // Source file identified by name, size, and modification time
+  std::uint64_t src_size {0};
+  std::int64_t src_mtime {0};
+  sourceId(fname, src_size, src_mtime);
+  std::uint64_t hash {fnv1a::offset};
+  fnv1a::hash(hash, fname.data(), fname.size());
+  fnv1a::hash(hash, &src_size, sizeof(src_size));
+  fnv1a::hash(hash, &src_mtime, sizeof(src_mtime));
+
+  std::ostringstream name;
+  name << "eop_" << std::hex << std::setw(16) << std::setfill('0') <<
+          hash << ".bin";
+  return name.str();
+}
+
+
+void EopSys::sourceId(const std::string& fname,
+                      std::uint64_t& src_size, std::int64_t& src_mtime)
+{
+  std::error_code ec;
+  auto fsize = std::filesystem::file_size(fname, ec);
+  src_size = ec ? 0 : static_cast<std::uint64_t>(fsize);
+  auto ftime = std::filesystem::last_write_time(fname, ec);
+  src_mtime = ec ? 0 : static_cast<std::int64_t>(
+                           ftime.time_since_epoch().count());
+}
+
+
+bool EopSys::readCache(const std::string& cache_file,
+                       const std::string& fname)
+{
+  std::unique_ptr<MappedFile> mf {nullptr};
+  try {
+    mf = std::make_unique<MappedFile>(cache_file);
+  } catch (const std::runtime_error& re) {
+    return false;
+  }
+  if (mf->size() < sizeof(cache_header)) {
+    return false;
+  }
+
+    // Header must match the current source file
+  cache_header hdr;
+  std::memcpy(&hdr, mf->data(), sizeof(hdr));
+  std::uint64_t src_size {0};
+  std::int64_t src_mtime {0};
+  sourceId(fname, src_size, src_mtime);
+  if (std::memcmp(hdr.magic, cache_magic, sizeof(cache_magic)) != 0  ||
+      hdr.version != cache_version  ||
+      hdr.rec_size != sizeof(cache_record)  ||
+      hdr.src_size != src_size  ||
+      hdr.src_mtime != src_mtime  ||
+      mf->size() != sizeof(hdr) + hdr.nrec*sizeof(cache_record)) {
+    return false;
+  }
+
+    // Direct indexing of only the records needed
+  long first {static_cast<long>(mjd_first) - hdr.mjd0};
+  long last {static_cast<long>(mjd_last) - hdr.mjd0};
+  if (first < 0L  ||  last >= static_cast<long>(hdr.nrec)) {
+    return false;
+  }
+  const char* rec {mf->data() + sizeof(hdr) + first*sizeof(cache_record)};
+  eopData.clear();
+  eopData.reserve(last - first + 1L);
+  for (long ii=first; ii<=last; ++ii) {
+    cache_record cr;
+    std::memcpy(&cr, rec, sizeof(cr));
+    rec += sizeof(cr);
+    eop_record eop;
+    eop.mjd = hdr.mjd0 + ii;
+    eop.xp = cr.xp;
+    eop.yp = cr.yp;
+    eop.ut1mutc = cr.ut1mutc;
+    eop.lod = cr.lod;
+    eop.dx = cr.dx;
+    eop.dy = cr.dy;
+    eopData.push_back(eop);
+  }
 
+  return true;
+}
+
+
+void EopSys::writeCache(const std::string& cache_file,
+                        const std::string& fname,
+                        const std::vector<eop_record>& records) const
+{
+  if (records.empty()) {
+    return;
+  }
+  cache_header hdr;
+  std::memcpy(hdr.magic, cache_magic, sizeof(cache_magic));
+  hdr.version = cache_version;
+  hdr.rec_size = sizeof(cache_record);
+  sourceId(fname, hdr.src_size, hdr.src_mtime);
+  hdr.mjd0 = records.front().mjd;
+  hdr.nrec = records.size();
+
+    // Write to a unique temporary file and rename so concurrent
+    // processes never read a partially written cache
+  std::ostringstream tmp_name;
+  tmp_name << cache_file << '.' << std::hex << std::random_device{}();
+  std::ofstream fout(tmp_name.str(), std::ios::binary);
+  if (!fout.is_open()) {
+    return;
+  }
+  fout.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+  for (const auto& eop : records) {
+    cache_record cr {eop.xp, eop.yp, eop.ut1mutc, eop.lod, eop.dx, eop.dy};
+    fout.write(reinterpret_cast<const char*>(&cr), sizeof(cr));
+  }
+  fout.close();
+  if (fout.fail()  ||
+      std::rename(tmp_name.str().c_str(), cache_file.c_str())) {
+    std::remove(tmp_name.str().c_str());
+  }
 }
 
 
@@ -171,6 +469,9 @@ eop_record EopSys::getEop(const JulianDate& jd) const
   dpdt(0) = eopData[ndx2].xp      - eopData[ndx1].xp;
   dpdt(1) = eopData[ndx2].yp      - eopData[ndx1].yp;
   dpdt(2) = eopData[ndx2].ut1mutc - eopData[ndx1].ut1mutc;
+    // A leap second at the end of the day steps UT1 - UTC by a whole
+    // second - only the continuous change is interpolated
+  dpdt(2) -= std::round(dpdt(2));
   dpdt(3) = eopData[ndx2].lod     - eopData[ndx1].lod;
   dpdt(4) = eopData[ndx2].dx      - eopData[ndx1].dx;
   dpdt(5) = eopData[ndx2].dy      - eopData[ndx1].dy;
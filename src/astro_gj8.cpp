@@ -0,0 +1,175 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_gj8.h>
+
+#include <utility>
+#include <memory>
+#include <array>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <mth_ode.h>
+#include <mth_rkf78.h>
+
+namespace {
+    // Position and velocity coefficients applied to accelerations,
+    // most recent first, for the predictor (next point) and corrector
+    // (most recent point).  Derived from the backward difference
+    // expansions of D^-2 and D^-1 truncated after the 8th difference,
+    // less the second and first sums.
+  constexpr double gja_den {159667200.0};
+  constexpr std::array<double, 9> gja_pred {
+    103798439.0, -385853488.0, 867424848.0, -1274515624.0, 1258146350.0,
+    -831418464.0, 354064088.0, -88091848.0, 9751299.0
+  };
+  constexpr std::array<double, 9> gja_corr {
+    9751299.0, 16036748.0, -34806724.0, 48315732.0, -45851950.0,
+    29482676.0, -12309348.0, 3017324.0, -330157.0
+  };
+  constexpr double gjb_den {7257600.0};
+  constexpr std::array<double, 9> gjb_pred {
+    23019647.0, -81975542.0, 183957138.0, -270704638.0, 267659200.0,
+    -177112962.0, 75505262.0, -18802058.0, 2082753.0
+  };
+  constexpr std::array<double, 9> gjb_corr {
+    -5174847.0, 4274870.0, -6996434.0, 9005886.0, -8277760.0,
+    5232322.0, -2161710.0, 526154.0, -57281.0
+  };
+    // RKF7(8) startup steps per Gauss-Jackson step
+  constexpr int startup_substeps {4};
+}
+
+namespace eom {
+
+
+Gj8::Gj8(std::unique_ptr<Ode<JulianDate, double, 6>> deq,
+         const Duration& dt,
+         const JulianDate& jd,
+         const Eigen::Matrix<double, 6, 1>& x)
+{
+  m_deq = std::move(deq);
+  m_dt = dt;
+  m_jd = jd;
+  m_x = x;
+    // Default integration step size if not explicitly set
+  if (m_dt.getTu() == 0.0) {
+    Duration dt_default(0.3, phy_const::tu_per_min);
+    m_dt = dt_default;
+  }
+  m_h = m_dt.getTu();
+  m_dx = m_deq->getXdot(jd, m_x);
+
+    // Startup window via RKF7(8), epoch first
+  m_xs[0] = m_x;
+  m_dxs[0] = m_dx;
+  Duration rkdt(m_h/startup_substeps, 1.0);
+  JulianDate jdNow {jd};
+  Eigen::Matrix<double, 6, 1> xnow {m_x};
+  Eigen::Matrix<double, 6, 1> dxnow {m_dx};
+  Eigen::Matrix<double, 6, 1> xnext;
+  Eigen::Matrix<double, 6, 1> xerr;
+  for (int ii=1; ii<=order; ++ii) {
+    for (int jj=0; jj<startup_substeps; ++jj) {
+      rkf78_step(m_deq.get(), rkdt, jdNow, xnow, dxnow, xnext, xerr);
+      jdNow += rkdt;
+      xnow = xnext;
+      dxnow = m_deq->getXdot(jdNow, xnow);
+    }
+    m_xs[ii] = xnow;
+    m_dxs[ii] = dxnow;
+  }
+  for (int ii=0; ii<=order; ++ii) {
+    m_acc[ii] = m_dxs[order-ii].block<3, 1>(3, 0);
+  }
+
+    // Initialize sums so the corrector reproduces the most recent point
+  Eigen::Matrix<double, 3, 1> sa = Eigen::Matrix<double, 3, 1>::Zero();
+  Eigen::Matrix<double, 3, 1> sb = Eigen::Matrix<double, 3, 1>::Zero();
+  for (int ii=0; ii<=order; ++ii) {
+    sa += gja_corr[ii]*m_acc[ii];
+    sb += gjb_corr[ii]*m_acc[ii];
+  }
+  m_s1 = m_xs[order].block<3, 1>(3, 0)/m_h - sb/gjb_den;
+  m_s2 = m_xs[order].block<3, 1>(0, 0)/(m_h*m_h) + m_s1 - sa/gja_den;
+}
+
+
+JulianDate Gj8::getT() const noexcept
+{
+  return m_jd;
+}
+
+
+Eigen::Matrix<double, 6, 1> Gj8::getX() const noexcept
+{
+  return m_x;
+}
+
+
+Eigen::Matrix<double, 6, 1> Gj8::getXdot() const noexcept
+{
+  return m_dx;
+}
+
+
+JulianDate Gj8::step()
+{
+  m_jd += m_dt;
+
+    // Still using startup values
+  if (m_istep < order) {
+    m_istep++;
+    m_x = m_xs[m_istep];
+    m_dx = m_dxs[m_istep];
+    return m_jd;
+  }
+
+  const double h2 {m_h*m_h};
+  Eigen::Matrix<double, 3, 1> sa = Eigen::Matrix<double, 3, 1>::Zero();
+  Eigen::Matrix<double, 3, 1> sb = Eigen::Matrix<double, 3, 1>::Zero();
+
+    // Predict and evaluate
+  for (int ii=0; ii<=order; ++ii) {
+    sa += gja_pred[ii]*m_acc[ii];
+    sb += gjb_pred[ii]*m_acc[ii];
+  }
+  m_x.block<3, 1>(0, 0) = h2*(m_s2 + sa/gja_den);
+  m_x.block<3, 1>(3, 0) = m_h*(m_s1 + sb/gjb_den);
+  m_dx = m_deq->getXdot(m_jd, m_x, OdeEvalMethod::predictor);
+  for (int ii=order; ii>0; --ii) {
+    m_acc[ii] = m_acc[ii-1];
+  }
+  m_acc[0] = m_dx.block<3, 1>(3, 0);
+
+    // Correct and evaluate
+  Eigen::Matrix<double, 3, 1> s1 = m_s1 + m_acc[0];
+  Eigen::Matrix<double, 3, 1> s2 = m_s2 + s1;
+  sa.setZero();
+  sb.setZero();
+  for (int ii=0; ii<=order; ++ii) {
+    sa += gja_corr[ii]*m_acc[ii];
+    sb += gjb_corr[ii]*m_acc[ii];
+  }
+  m_x.block<3, 1>(0, 0) = h2*(s2 - s1 + sa/gja_den);
+  m_x.block<3, 1>(3, 0) = m_h*(s1 + sb/gjb_den);
+  m_dx = m_deq->getXdot(m_jd, m_x, OdeEvalMethod::corrector);
+  m_acc[0] = m_dx.block<3, 1>(3, 0);
+
+    // Update sums with the corrected acceleration
+  m_s1 += m_acc[0];
+  m_s2 += m_s1;
+
+  return m_jd;
+}
+
+
+}
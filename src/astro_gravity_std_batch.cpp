@@ -0,0 +1,228 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_gravity_std_batch.h>
+
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <mth_ode.h>
+#include <astro_egm_coeff.h>
+
+namespace eom {
+
+GravityStdBatch::GravityStdBatch(int max_degree, int max_order, int lanes)
+{
+  if (max_order > max_degree) {
+    throw std::invalid_argument("GravityStdBatch::GravityStdBatch() "
+                                "Order > Degree");
+  }
+  if (max_degree < 0  ||  max_degree > egm_coeff::degree) {
+    throw std::invalid_argument(
+        "GravityStdBatch::GravityStdBatch() Unsupported Degree: " +
+        std::to_string(max_degree)
+    );
+  }
+  if (max_order < 0  ||  max_order > egm_coeff::order) {
+    throw std::invalid_argument(
+        "GravityStdBatch::GravityStdBatch() Unsupported Order: " +
+        std::to_string(max_order)
+    );
+  }
+  if (lanes < 1) {
+    throw std::invalid_argument(
+        "GravityStdBatch::GravityStdBatch() Lanes must be positive");
+  }
+
+  m_degree = max_degree;
+  m_order = max_order;
+  m_lanes = lanes;
+  m_padded = block_lanes*((lanes + block_lanes - 1)/block_lanes);
+    // First two trig harmonics and powers of re/r are always set
+  m_smlon = LaneArray::Zero(std::max(2, max_order + 1), m_padded);
+  m_cmlon = LaneArray::Zero(std::max(2, max_order + 1), m_padded);
+  m_re_r_n = LaneArray::Zero(std::max(2, max_degree + 1), m_padded);
+  m_tlat = LaneArray::Zero(1, m_padded);
+    // Zeroed for P(n-2,m) where m > n, see LegendreAf
+  m_alf_cols = max_order + 2;
+  m_alf = LaneArray::Zero((max_degree + 1)*m_alf_cols, m_padded);
+  m_gs = LaneArray::Zero(3, m_padded);
+
+    //  Locate indicies to be accumulated, smallest terms first
+  for (int ndx=(egm_coeff::nc-1); ndx>=0; --ndx) {
+    int nn {egm_coeff::xn[ndx]};
+    int mm {egm_coeff::xm[ndx]};
+    if (nn <= m_degree  &&  mm <= m_order) {
+      ndx_list.push_back(ndx);
+    }
+  }
+  ndx_list.shrink_to_fit();
+}
+
+
+void GravityStdBatch::getAccelerations(
+    const Eigen::Ref<const Eigen::Matrix<double, 3, Eigen::Dynamic>>& pos,
+    OdeEvalMethod entry,
+    Eigen::Ref<Eigen::Matrix<double, 3, Eigen::Dynamic>> acc)
+{
+  using namespace egm_coeff;
+
+  if (pos.cols() != m_lanes  ||  acc.cols() != m_lanes) {
+    throw std::invalid_argument("GravityStdBatch::getAccelerations() "
+                                "One column per lane required");
+  }
+
+  if (entry == OdeEvalMethod::predictor) {
+      // Per lane geometry seeds the recursions, padding lanes
+      // duplicating the first
+    for (int kk=0; kk<m_padded; ++kk) {
+      const int src {kk < m_lanes ? kk : 0};
+      const double rx {pos(0, src)};
+      const double ry {pos(1, src)};
+      const double rz {pos(2, src)};
+      const double rmag {pos.col(src).norm()};
+      const double invr {1.0/rmag};
+      const double rxy {std::sqrt(rx*rx + ry*ry)};
+      const double invrxy {1.0/rxy};
+      m_tlat(0, kk) = rz*invrxy;
+      m_re_r_n(0, kk) = 1.0;
+      m_re_r_n(1, kk) = phy_const::re*invr;
+      m_smlon(0, kk) = 0.0;
+      m_smlon(1, kk) = ry*invrxy;
+      m_cmlon(0, kk) = 1.0;
+      m_cmlon(1, kk) = rx*invrxy;
+      m_alf(0, kk) = 1.0;
+      if (m_degree > 0) {
+        m_alf(m_alf_cols, kk) = rz*invr;
+        m_alf(m_alf_cols + 1, kk) = rxy*invr;
+      }
+    }
+
+      // Trig harmonics through order and scale factor through degree
+    const double* clon {m_cmlon.row(1).data()};
+    const double* re_r {m_re_r_n.row(1).data()};
+    for (int kk=0; kk<m_padded; kk+=block_lanes) {
+      const LaneBlock clon_k {clon + kk};
+      const LaneBlock re_r_k {re_r + kk};
+      for (int mdx=2; mdx<=m_order; ++mdx) {
+        const double* sm1 {m_smlon.row(mdx-1).data() + kk};
+        const double* sm2 {m_smlon.row(mdx-2).data() + kk};
+        const double* cm1 {m_cmlon.row(mdx-1).data() + kk};
+        const double* cm2 {m_cmlon.row(mdx-2).data() + kk};
+        LaneBlockOut(m_smlon.row(mdx).data() + kk) =
+            2.0*clon_k*LaneBlock(sm1) - LaneBlock(sm2);
+        LaneBlockOut(m_cmlon.row(mdx).data() + kk) =
+            2.0*clon_k*LaneBlock(cm1) - LaneBlock(cm2);
+        LaneBlockOut(m_re_r_n.row(mdx).data() + kk) =
+            re_r_k*LaneBlock(m_re_r_n.row(mdx-1).data() + kk);
+      }
+      for (int ndx=std::max(2, m_order+1); ndx<=m_degree; ++ndx) {
+        LaneBlockOut(m_re_r_n.row(ndx).data() + kk) =
+            re_r_k*LaneBlock(m_re_r_n.row(ndx-1).data() + kk);
+      }
+    }
+
+      // Associated Legendre functions, recursion of LegendreAf::set()
+    if (m_degree > 0) {
+      const int mmax {m_order + 1};
+      for (int kk=0; kk<m_padded; kk+=block_lanes) {
+        const LaneBlock sx {m_alf.row(m_alf_cols).data() + kk};
+        const LaneBlock cx {m_alf.row(m_alf_cols + 1).data() + kk};
+        auto alf = [this, kk](int n, int m) {
+          return m_alf.row(n*m_alf_cols + m).data() + kk;
+        };
+        for (int nn=2; nn<=m_degree; ++nn) {
+          const double c2n1 {static_cast<double>(2*nn - 1)};
+          for (int mm=0; mm<=mmax; ++mm) {
+            if (nn == mm) {
+              LaneBlockOut(alf(nn, nn)) = c2n1*cx*LaneBlock(alf(nn-1, nn-1));
+            } else if (mm != 0) {
+              LaneBlockOut(alf(nn, mm)) = LaneBlock(alf(nn-2, mm)) +
+                                          c2n1*cx*LaneBlock(alf(nn-1, mm-1));
+            } else {
+              LaneBlockOut(alf(nn, 0)) = (c2n1*sx*LaneBlock(alf(nn-1, 0)) -
+                                          (nn - 1)*LaneBlock(alf(nn-2, 0)))/nn;
+            }
+          }
+        }
+      }
+    }
+
+      // Accumulate selected egm_coeff terms, lanes innermost in fixed
+      // size blocks so the three partials are accumulated in a single
+      // vectorized pass
+    m_gs.setZero();
+    for (const int ndx : ndx_list) {
+      const int nn {xn[ndx]};
+      const int mm {xm[ndx]};
+      const double np1 {static_cast<double>(nn + 1)};
+      const double dm {static_cast<double>(mm)};
+      const double cc {cnm[ndx]};
+      const double ss {snm[ndx]};
+      const double* pnm_row {m_alf.row(nn*m_alf_cols + mm).data()};
+      const double* pnmp1_row {m_alf.row(nn*m_alf_cols + mm + 1).data()};
+      const double* re_r_n_row {m_re_r_n.row(nn).data()};
+      const double* cmlon_row {m_cmlon.row(mm).data()};
+      const double* smlon_row {m_smlon.row(mm).data()};
+      for (int kk=0; kk<m_padded; kk+=block_lanes) {
+        const LaneBlock pnm {pnm_row + kk};
+        const LaneBlock pnmp1 {pnmp1_row + kk};
+        const LaneBlock re_r_n {re_r_n_row + kk};
+        const LaneBlock cmlon {cmlon_row + kk};
+        const LaneBlock smlon {smlon_row + kk};
+        const LaneBlock tlat {m_tlat.data() + kk};
+        Eigen::Map<Eigen::Array<double, block_lanes, 1>> du_dr {
+            m_gs.row(0).data() + kk
+        };
+        Eigen::Map<Eigen::Array<double, block_lanes, 1>> du_dlat {
+            m_gs.row(1).data() + kk
+        };
+        Eigen::Map<Eigen::Array<double, block_lanes, 1>> du_dlon {
+            m_gs.row(2).data() + kk
+        };
+        du_dr += np1*re_r_n*pnm*(cc*cmlon + ss*smlon);
+        du_dlat += re_r_n*(pnmp1 - dm*tlat*pnm)*(cc*cmlon + ss*smlon);
+        du_dlon += dm*re_r_n*pnm*(ss*cmlon - cc*smlon);
+      }
+    }
+      // Central body
+    m_gs.row(0) += 1.0;
+  }
+
+    // Complete partials and convert from spherical to Cartesian per lane
+  for (int kk=0; kk<m_lanes; ++kk) {
+    const double rx {pos(0, kk)};
+    const double ry {pos(1, kk)};
+    const double rz {pos(2, kk)};
+    const double rmag {pos.col(kk).norm()};
+    const double invr {1.0/rmag};
+    const double invr2 {invr*invr};
+    const double rxy2 {rx*rx + ry*ry};
+    const double rxy {std::sqrt(rxy2)};
+    const double invrxy {1.0/rxy};
+    const double invrxy2 {invrxy*invrxy};
+
+    double gm_r {phy_const::gm*invr};
+    double du_dr {-1.0*gm_r*invr*m_gs(0, kk)};
+    double du_dlat {gm_r*m_gs(1, kk)};
+    double du_dlon {gm_r*m_gs(2, kk)};
+    double dlat {invr*du_dr - du_dlat*rz*invrxy*invr2};
+    double dlon {du_dlon*invrxy2};
+    acc(0, kk) = dlat*rx - dlon*ry;
+    acc(1, kk) = dlat*ry + dlon*rx;
+    acc(2, kk) = invr*du_dr*rz + du_dlat*rxy*invr2;
+  }
+}
+
+
+}
@@ -42,7 +42,8 @@ GroundStation::getStateVector(const JulianDate& jd, EphemFrame frame) const
   xecf.block<3,1>(3,0) = m_vel0f;
 
   if (frame == EphemFrame::eci) {
-    return m_ecfeci->ecf2eci(jd, xecf.block<3,1>(0,0), xecf.block<3,1>(3,0));
+    return m_ecfeci->getTransform(jd).ecf2eci(xecf.block<3,1>(0,0),
+                                              xecf.block<3,1>(3,0));
   }
   return xecf;
 }
@@ -61,7 +62,7 @@ Eigen::Matrix<double, 3, 1> GroundStation::getPosition(const JulianDate& jd,
   Eigen::Matrix<double, 3, 1> posf = m_pos0f + dt*m_vel0f;
 
   if (frame == EphemFrame::eci) {
-    return m_ecfeci->ecf2eci(jd, posf);
+    return m_ecfeci->getTransform(jd).ecf2eci(posf);
   }
   return posf;
 }
@@ -19,8 +19,11 @@
 
 #include <phy_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <mth_hermite1.h>
 #include <astro_ephemeris.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
 #include <mth_index_mapper.h>
 
 namespace eom {
@@ -112,4 +115,74 @@ Eigen::Matrix<double, 3, 1> Hermite1Eph::getPosition(const JulianDate& jd,
 }
 
 
+void Hermite1Eph::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "Hermite1Eph");
+
+  unsigned long ndx {0UL};
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    try {
+      ndx = m_ndxr->getIndex(jd[ii], ndx);
+    } catch (const std::out_of_range& ia) {
+      throw std::out_of_range("Hermite1Eph::getStateVectors() - bad time");
+    }
+    const auto& irec = m_eph_interpolators[ndx];
+    double dt_tu {phy_const::tu_per_day*(jd[ii] - irec.jd1)};
+    xvec.block<3,1>(0,ii) = irec.hItp.getPosition(dt_tu);
+    xvec.block<3,1>(3,ii) = irec.hItp.getVelocity(dt_tu);
+  }
+
+  if (frame == EphemFrame::ecf) {
+    m_ecfeciSys->eci2ecf(jd, xvec, xvec);
+  }
+}
+
+
+void Hermite1Eph::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "Hermite1Eph");
+  if (n == 0UL) {
+    return;
+  }
+
+  unsigned long ndx {};
+  try {
+    ndx = m_ndxr->getIndex(start);
+  } catch (const std::out_of_range& ia) {
+    throw std::out_of_range("Hermite1Eph::sample() - bad time");
+  }
+  const unsigned long nrec {m_eph_interpolators.size()};
+  const double dt_days {dt.getDays()};
+  EcfEciCursor f2i {m_ecfeciSys};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+      // Step to the record containing jd
+    while (ndx + 1UL < nrec  &&  m_eph_interpolators[ndx].jd2 < jd) {
+      ndx++;
+    }
+    while (ndx > 0UL  &&  jd < m_eph_interpolators[ndx].jd1) {
+      ndx--;
+    }
+    const auto& irec = m_eph_interpolators[ndx];
+    if (jd < irec.jd1  ||  irec.jd2 < jd) {
+      throw std::out_of_range("Hermite1Eph::sample() - bad time");
+    }
+    double dt_tu {phy_const::tu_per_day*(jd - irec.jd1)};
+    xvec.block<3,1>(0,ii) = irec.hItp.getPosition(dt_tu);
+    xvec.block<3,1>(3,ii) = irec.hItp.getVelocity(dt_tu);
+
+    if (frame == EphemFrame::ecf) {
+      xvec.col(ii) = f2i.getTransform(jd).eci2ecf(xvec.block<3,1>(0,ii),
+                                                  xvec.block<3,1>(3,ii));
+    }
+  }
+}
+
+
 }
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <array>
+#include <vector>
 #include <utility>
 #include <memory>
 
@@ -17,9 +18,12 @@
 
 #include <cal_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <phy_const.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
 
 #include <Vinti.h>
 
@@ -45,43 +49,88 @@ Kepler::Kepler(const std::string& orbit_name,
 
 Eigen::Matrix<double, 6, 1> Kepler::getStateVector(const JulianDate& jd,
                                                    EphemFrame frame) const 
+{
+  Eigen::Matrix<double, 6, 1> xeci = this->propagate(jd);
+
+  if (frame == EphemFrame::ecf) {
+    return m_ecfeci->eci2ecf(jd, xeci.block<3,1>(0,0), xeci.block<3,1>(3,0));
+  }
+  return xeci;
+}
+
+
+Eigen::Matrix<double, 3, 1> Kepler::getPosition(const JulianDate& jd,
+                                                EphemFrame frame) const
 {
   double x {0.0};
   std::array<double, 6> x1;
   double t1 {cal_const::sec_per_day*(jd - m_jd0)};
   Kepler1(m_planet.data(), 0.0, m_x0.data(), t1, x1.data(), &x);
 
-  Eigen::Matrix<double, 6, 1> xeci;
+  Eigen::Matrix<double, 3, 1> xeci;
   xeci(0) = phy_const::du_per_km*x1[0];
   xeci(1) = phy_const::du_per_km*x1[1];
   xeci(2) = phy_const::du_per_km*x1[2];
-  xeci(3) = phy_const::du_per_km*x1[3]*phy_const::sec_per_tu;
-  xeci(4) = phy_const::du_per_km*x1[4]*phy_const::sec_per_tu;
-  xeci(5) = phy_const::du_per_km*x1[5]*phy_const::sec_per_tu;
 
   if (frame == EphemFrame::ecf) {
-    return m_ecfeci->eci2ecf(jd, xeci.block<3,1>(0,0), xeci.block<3,1>(3,0));
+    return m_ecfeci->eci2ecf(jd, xeci);
   }
   return xeci;
 }
 
 
-Eigen::Matrix<double, 3, 1> Kepler::getPosition(const JulianDate& jd,
-                                                EphemFrame frame) const
+void Kepler::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "Kepler");
+
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    xvec.col(ii) = this->propagate(jd[ii]);
+  }
+
+  if (frame == EphemFrame::ecf) {
+    m_ecfeci->eci2ecf(jd, xvec, xvec);
+  }
+}
+
+
+void Kepler::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "Kepler");
+
+  double dt_days {dt.getDays()};
+  EcfEciCursor f2i {m_ecfeci};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+    xvec.col(ii) = this->propagate(jd);
+    if (frame == EphemFrame::ecf) {
+      xvec.col(ii) = f2i.getTransform(jd).eci2ecf(xvec.block<3,1>(0,ii),
+                                                  xvec.block<3,1>(3,ii));
+    }
+  }
+}
+
+
+Eigen::Matrix<double, 6, 1> Kepler::propagate(const JulianDate& jd) const
 {
   double x {0.0};
   std::array<double, 6> x1;
   double t1 {cal_const::sec_per_day*(jd - m_jd0)};
   Kepler1(m_planet.data(), 0.0, m_x0.data(), t1, x1.data(), &x);
 
-  Eigen::Matrix<double, 3, 1> xeci;
+  Eigen::Matrix<double, 6, 1> xeci;
   xeci(0) = phy_const::du_per_km*x1[0];
   xeci(1) = phy_const::du_per_km*x1[1];
   xeci(2) = phy_const::du_per_km*x1[2];
+  xeci(3) = phy_const::du_per_km*x1[3]*phy_const::sec_per_tu;
+  xeci(4) = phy_const::du_per_km*x1[4]*phy_const::sec_per_tu;
+  xeci(5) = phy_const::du_per_km*x1[5]*phy_const::sec_per_tu;
 
-  if (frame == EphemFrame::ecf) {
-    return m_ecfeci->eci2ecf(jd, xeci);
-  }
   return xeci;
 }
 
@@ -0,0 +1,293 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_mapped_ephemeris.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <utl_mapped_file.h>
+#include <mth_hermite2_table.h>
+#include <astro_ephemeris.h>
+#include <astro_ephemeris_binary.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
+
+namespace eom {
+
+MappedEphemeris::MappedEphemeris(const std::string& name,
+                                 const std::string& fname,
+                                 std::shared_ptr<const EcfEciSys> ecfeciSys)
+{
+  m_name = name;
+  m_ecfeciSys = std::move(ecfeciSys);
+  m_file = std::make_unique<MappedFile>(fname);
+
+  eph_binary::header hdr;
+  if (m_file->size() < sizeof(hdr)) {
+    throw std::runtime_error(
+        "MappedEphemeris::MappedEphemeris() Invalid file " + fname);
+  }
+  std::memcpy(&hdr, m_file->data(), sizeof(hdr));
+  if (std::memcmp(hdr.magic, eph_binary::magic,
+                  sizeof(eph_binary::magic)) != 0) {
+    throw std::runtime_error(
+        "MappedEphemeris::MappedEphemeris() Not an EOM ephemeris file " +
+        fname);
+  }
+  if (hdr.byte_order != eph_binary::byte_order  ||
+      hdr.version != eph_binary::version) {
+    throw std::runtime_error(
+        "MappedEphemeris::MappedEphemeris() Unsupported version or byte "
+        "order " + fname);
+  }
+  m_compact = hdr.coeff_bytes == sizeof(float);
+  m_ecf = hdr.nframes == 2;
+  std::uint64_t block_bytes {m_compact ?
+                             Hermite2Table<double, 3, float>::blockSize() :
+                             Hermite2Table<double, 3>::blockSize()};
+  if ((!m_compact  &&  hdr.coeff_bytes != sizeof(double))  ||
+      (hdr.nframes != 1  &&  hdr.nframes != 2)  ||
+      hdr.block_bytes != block_bytes  ||  hdr.nnodes < 2) {
+    throw std::runtime_error(
+        "MappedEphemeris::MappedEphemeris() Invalid header " + fname);
+  }
+    // Node times are accessed in place - they must follow the header
+    // and be aligned (the mapping itself is page aligned)
+  if (hdr.times_offset < sizeof(hdr)  ||
+      hdr.times_offset%alignof(double) != 0) {
+    throw std::runtime_error(
+        "MappedEphemeris::MappedEphemeris() Invalid header " + fname);
+  }
+    // Section sizes are compared against the space remaining in the
+    // file, before forming any sums or products, so malformed sizes
+    // can't overflow past the size check
+  const std::uint64_t fsize {m_file->size()};
+  std::uint64_t npoly {hdr.nnodes - 1};
+  if (hdr.times_offset > fsize  ||
+      hdr.nnodes > (fsize - hdr.times_offset)/(2*sizeof(double))) {
+    throw std::runtime_error(
+        "MappedEphemeris::MappedEphemeris() Truncated file " + fname);
+  }
+  std::uint64_t end {hdr.times_offset + 2*hdr.nnodes*sizeof(double)};
+  for (unsigned int ii=0; ii<hdr.nframes; ++ii) {
+    if (hdr.coeff_offset[ii] < end) {
+      throw std::runtime_error(
+          "MappedEphemeris::MappedEphemeris() Invalid header " + fname);
+    }
+    if (hdr.coeff_offset[ii] > fsize  ||
+        npoly > (fsize - hdr.coeff_offset[ii])/block_bytes) {
+      throw std::runtime_error(
+          "MappedEphemeris::MappedEphemeris() Truncated file " + fname);
+    }
+    end = hdr.coeff_offset[ii] + npoly*block_bytes;
+  }
+
+  m_jdEpoch = JulianDate(hdr.epoch[0], hdr.epoch[1]);
+  m_jdStart = JulianDate(hdr.start[0], hdr.start[1]);
+  m_jdStop = JulianDate(hdr.stop[0], hdr.stop[1]);
+  m_nnodes = hdr.nnodes;
+  m_times = reinterpret_cast<const double*>(m_file->data() +
+                                            hdr.times_offset);
+  const char* eci_data {m_file->data() + hdr.coeff_offset[0]};
+  const char* ecf_data {m_file->data() + hdr.coeff_offset[1]};
+  if (m_compact) {
+    m_eci_compact = Hermite2Table<double, 3, float>(eci_data, npoly);
+    if (m_ecf) {
+      m_ecf_compact = Hermite2Table<double, 3, float>(ecf_data, npoly);
+    }
+  } else {
+    m_eci_tbl = Hermite2Table<double, 3>(eci_data, npoly);
+    if (m_ecf) {
+      m_ecf_tbl = Hermite2Table<double, 3>(ecf_data, npoly);
+    }
+  }
+}
+
+
+unsigned long MappedEphemeris::locate(const JulianDate& jd,
+                                      unsigned long hint) const
+{
+  const unsigned long npoly {m_nnodes - 1UL};
+  for (unsigned long ndx=hint; ndx<npoly  &&  ndx<hint+2UL; ++ndx) {
+    if (!(jd < this->node(ndx))  &&  !(this->node(ndx+1UL) < jd)) {
+      return ndx;
+    }
+  }
+  if (jd < this->node(0UL)  ||  this->node(npoly) < jd) {
+    throw std::out_of_range("MappedEphemeris::locate() - bad time");
+  }
+
+    // First interior node following jd ends the covering polynomial
+  unsigned long lo {1UL};
+  unsigned long hi {npoly};
+  while (lo < hi) {
+    unsigned long mid {lo + (hi - lo)/2UL};
+    if (jd < this->node(mid)) {
+      hi = mid;
+    } else {
+      lo = mid + 1UL;
+    }
+  }
+  return lo - 1UL;
+}
+
+
+Eigen::Matrix<double, 3, 1> MappedEphemeris::evalPosition(EphemFrame frame,
+                                                          unsigned long ndx,
+                                                          double dt) const
+{
+  bool use_ecf {m_ecf  &&  frame == EphemFrame::ecf};
+  if (m_compact) {
+    return use_ecf ? m_ecf_compact.getPosition(ndx, dt) :
+                     m_eci_compact.getPosition(ndx, dt);
+  }
+  return use_ecf ? m_ecf_tbl.getPosition(ndx, dt) :
+                   m_eci_tbl.getPosition(ndx, dt);
+}
+
+
+Eigen::Matrix<double, 3, 1> MappedEphemeris::evalVelocity(EphemFrame frame,
+                                                          unsigned long ndx,
+                                                          double dt) const
+{
+  bool use_ecf {m_ecf  &&  frame == EphemFrame::ecf};
+  if (m_compact) {
+    return use_ecf ? m_ecf_compact.getVelocity(ndx, dt) :
+                     m_eci_compact.getVelocity(ndx, dt);
+  }
+  return use_ecf ? m_ecf_tbl.getVelocity(ndx, dt) :
+                   m_eci_tbl.getVelocity(ndx, dt);
+}
+
+
+Eigen::Matrix<double, 6, 1>
+MappedEphemeris::getStateVector(const JulianDate& jd, EphemFrame frame) const
+{
+  unsigned long ndx {};
+  try {
+    ndx = this->locate(jd, 0UL);
+  } catch (const std::out_of_range& ia) {
+    throw std::out_of_range("MappedEphemeris::getStateVector() - bad time");
+  }
+  bool native {frame == EphemFrame::eci  ||  m_ecf};
+  double dt_tu {phy_const::tu_per_day*(jd - this->node(ndx))};
+  Eigen::Matrix<double, 6, 1> xvec;
+  xvec.block<3,1>(0,0) = this->evalPosition(frame, ndx, dt_tu);
+  xvec.block<3,1>(3,0) = this->evalVelocity(frame, ndx, dt_tu);
+
+  if (!native) {
+    return m_ecfeciSys->eci2ecf(jd, xvec.block<3,1>(0,0), xvec.block<3,1>(3,0));
+  }
+
+  return xvec;
+}
+
+
+Eigen::Matrix<double, 3, 1>
+MappedEphemeris::getPosition(const JulianDate& jd, EphemFrame frame) const
+{
+  unsigned long ndx {};
+  try {
+    ndx = this->locate(jd, 0UL);
+  } catch (const std::out_of_range& ia) {
+    throw std::out_of_range("MappedEphemeris::getPosition() - bad time");
+  }
+  bool native {frame == EphemFrame::eci  ||  m_ecf};
+  double dt_tu {phy_const::tu_per_day*(jd - this->node(ndx))};
+  Eigen::Matrix<double, 3, 1> pos = this->evalPosition(frame, ndx, dt_tu);
+
+  if (!native) {
+    return m_ecfeciSys->eci2ecf(jd, pos);
+  }
+
+  return pos;
+}
+
+
+void MappedEphemeris::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "MappedEphemeris");
+
+  bool native {frame == EphemFrame::eci  ||  m_ecf};
+  unsigned long ndx {0UL};
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    try {
+      ndx = this->locate(jd[ii], ndx);
+    } catch (const std::out_of_range& ia) {
+      throw std::out_of_range("MappedEphemeris::getStateVectors() - bad time");
+    }
+    double dt_tu {phy_const::tu_per_day*(jd[ii] - this->node(ndx))};
+    xvec.block<3,1>(0,ii) = this->evalPosition(frame, ndx, dt_tu);
+    xvec.block<3,1>(3,ii) = this->evalVelocity(frame, ndx, dt_tu);
+  }
+
+  if (!native) {
+    m_ecfeciSys->eci2ecf(jd, xvec, xvec);
+  }
+}
+
+
+void MappedEphemeris::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "MappedEphemeris");
+  if (n == 0UL) {
+    return;
+  }
+
+  unsigned long ndx {};
+  try {
+    ndx = this->locate(start, 0UL);
+  } catch (const std::out_of_range& ia) {
+    throw std::out_of_range("MappedEphemeris::sample() - bad time");
+  }
+  bool native {frame == EphemFrame::eci  ||  m_ecf};
+  const unsigned long npoly {m_nnodes - 1UL};
+  const double dt_days {dt.getDays()};
+  EcfEciCursor f2i {m_ecfeciSys};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+      // Step to the polynomial containing jd
+    while (ndx + 1UL < npoly  &&  this->node(ndx+1UL) < jd) {
+      ndx++;
+    }
+    while (ndx > 0UL  &&  jd < this->node(ndx)) {
+      ndx--;
+    }
+    if (jd < this->node(ndx)  ||  this->node(ndx+1UL) < jd) {
+      throw std::out_of_range("MappedEphemeris::sample() - bad time");
+    }
+    double dt_tu {phy_const::tu_per_day*(jd - this->node(ndx))};
+    xvec.block<3,1>(0,ii) = this->evalPosition(frame, ndx, dt_tu);
+    xvec.block<3,1>(3,ii) = this->evalVelocity(frame, ndx, dt_tu);
+
+    if (!native) {
+      xvec.col(ii) = f2i.getTransform(jd).eci2ecf(xvec.block<3,1>(0,ii),
+                                                  xvec.block<3,1>(3,ii));
+    }
+  }
+}
+
+
+}
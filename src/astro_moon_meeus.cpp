@@ -80,7 +80,7 @@ Eigen::Matrix<double, 3, 1> MoonMeeus::getPosition(const JulianDate& jd,
     throw std::out_of_range("MoonMeeus::getPosition() - bad time");
   }
 
-  auto jdTT = eom::LeapSeconds::getInstance().utc2tt(jd);
+  auto jdTT = m_ecfeci->getLeapSeconds().utc2tt(jd);
   double jdCent {jdTT.getJulianCenturies()};
 
     // Moon's mean longitude, w.r.t. mean equinox of date
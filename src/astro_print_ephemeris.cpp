@@ -55,17 +55,18 @@ void print_ephemeris(std::string file_name,
     fout << std::scientific;
     fout.precision(16);
 
+    Eigen::Matrix<double, 6, Eigen::Dynamic> pv(6, nrec);
+    orbit.sample(jdStart, dtout, nrec, frame, pv);
+
     fout << '\n';
     for (unsigned long int ii=0UL; ii<nrec; ++ii) {
       double tsec {ii*dtsec};
       fout << "\n " << tsec << " ";
-      JulianDate jdNow {jdStart + cal_const::day_per_sec*tsec};
-      Eigen::Matrix<double, 6, 1> pv = orbit.getStateVector(jdNow, frame);
       for (int jj=0; jj<3; ++jj) {
-        fout << phy_const::m_per_du*pv(jj) << "  ";
+        fout << phy_const::m_per_du*pv(jj,ii) << "  ";
       }
       for (int jj=3; jj<6; ++jj) {
-        fout << phy_const::m_per_du*pv(jj)*phy_const::tu_per_sec << "  ";
+        fout << phy_const::m_per_du*pv(jj,ii)*phy_const::tu_per_sec << "  ";
       }
     }
     fout << "\n\n\nEND Ephemeris\n";
@@ -8,7 +8,10 @@
 
 #include <astro_propagator_config.h>
 
+#include <stdexcept>
+
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 
 namespace eom {
 
@@ -22,10 +25,25 @@ void PropagatorConfig::setStartStopTime(const JulianDate& jdStart,
 
 void PropagatorConfig::setPropagator(Propagator integration_method)
 {
+  if (m_max_lazy_segs > 0UL  &&  !fixedNodes(integration_method)) {
+    throw std::invalid_argument("PropagatorConfig::setPropagator() "
+                                "Integrator incompatible with MaxSegments");
+  }
   m_propagator = integration_method;
 }
 
 
+void PropagatorConfig::setTolerance(double rel_tol, double abs_tol)
+{
+  if (rel_tol <= 0.0  ||  abs_tol <= 0.0) {
+    throw std::invalid_argument("PropagatorConfig::setTolerance() "
+                                "Tolerances must be positive");
+  }
+  m_rel_tol = rel_tol;
+  m_abs_tol = abs_tol;
+}
+
+
 void PropagatorConfig::setGravityModel(GravityModel gravity_model)
 {
   m_gravity_model = gravity_model;
@@ -50,6 +68,41 @@ void  PropagatorConfig::enableOtherGravityModels() noexcept
 }
 
 
+void PropagatorConfig::enableEcfInterpolation() noexcept
+{
+  m_ecf_interp = true;
+}
+
+
+void PropagatorConfig::enableCompactStorage() noexcept
+{
+  m_compact = true;
+}
+
+
+void PropagatorConfig::setLazyPropagation(const Duration& seg,
+                                          unsigned long max_segments)
+{
+  if (seg.getTu() <= 0.0) {
+    throw std::invalid_argument(
+        "PropagatorConfig::setLazyPropagation() Segment must be positive");
+  }
+  if (max_segments > 0UL  &&  !fixedNodes(m_propagator)) {
+    throw std::invalid_argument("PropagatorConfig::setLazyPropagation() "
+                                "Integrator incompatible with MaxSegments");
+  }
+  m_lazy = true;
+  m_lazy_seg = seg;
+  m_max_lazy_segs = max_segments;
+}
+
+
+void PropagatorConfig::enableEnsemble() noexcept
+{
+  m_ensemble = true;
+}
+
+
 void PropagatorConfig::setDegreeOrder(int degree, int order)
 {
   m_degree = degree;
@@ -57,4 +110,21 @@ void PropagatorConfig::setDegreeOrder(int degree, int order)
 }
 
 
+bool PropagatorConfig::fixedNodes(Propagator integration_method) noexcept
+{
+    // Adaptive step selection depends on integrator history, and
+    // regularized multistep startup perturbs integrated time
+  switch (integration_method) {
+    case Propagator::adams:
+    case Propagator::rkf78:
+#ifdef GENPL
+    case Propagator::gjs:
+#endif
+      return false;
+    default:
+      return true;
+  }
+}
+
+
 }
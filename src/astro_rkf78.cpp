@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <astro_rkf78.h>
+
+#include <utility>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_julian_date.h>
+#include <cal_duration.h>
+#include <mth_ode.h>
+#include <mth_rkf78.h>
+
+namespace {
+    // Step size adjustment safety factor and limits
+  constexpr double safety {0.9};
+  constexpr double min_factor {0.2};
+  constexpr double max_factor {5.0};
+    // Smallest step size relative to the maximum step size
+  constexpr double min_step {1.0e-8};
+}
+
+namespace eom {
+
+
+Rkf78::Rkf78(std::unique_ptr<Ode<JulianDate, double, 6>> deq,
+             const Duration& dt,
+             const JulianDate& jd,
+             const Eigen::Matrix<double, 6, 1>& x,
+             double rel_tol,
+             double abs_tol)
+{
+  if (rel_tol <= 0.0  ||  abs_tol <= 0.0) {
+    throw std::invalid_argument("Rkf78::Rkf78() Tolerances must be positive");
+  }
+  m_deq = std::move(deq);
+  m_dt_max = dt.getTu();
+  m_rel_tol = rel_tol;
+  m_abs_tol = abs_tol;
+  m_jd = jd;
+  m_x = x;
+    // Default integration step size if not explicitly set
+  if (m_dt_max == 0.0) {
+    m_dt_max = Duration(0.3, phy_const::tu_per_min).getTu();
+  }
+  m_dt = m_dt_max;
+    // Acceleration at jd
+  m_dx = m_deq->getXdot(m_jd, m_x);
+}
+
+
+JulianDate Rkf78::getT() const noexcept
+{
+  return m_jd;
+}
+
+
+Eigen::Matrix<double, 6, 1> Rkf78::getX() const noexcept
+{
+  return m_x;
+}
+
+
+Eigen::Matrix<double, 6, 1> Rkf78::getXdot() const noexcept
+{
+  return m_dx;
+}
+
+
+JulianDate Rkf78::step()
+{
+  Eigen::Matrix<double, 6, 1> xnew;
+  Eigen::Matrix<double, 6, 1> xerr;
+  bool rejected {false};
+  for (;;) {
+    if (std::fabs(m_dt) < min_step*std::fabs(m_dt_max)) {
+      throw std::runtime_error("Rkf78::step() Step size underflow");
+    }
+    Duration dt(m_dt, 1.0);
+    rkf78_step(m_deq.get(), dt, m_jd, m_x, m_dx, xnew, xerr);
+
+      // Largest error relative to mixed absolute/relative tolerance
+    double err {0.0};
+    for (int ii=0; ii<6; ++ii) {
+      double scale {m_abs_tol + m_rel_tol*std::max(std::fabs(m_x(ii)),
+                                                   std::fabs(xnew(ii)))};
+      err = std::max(err, std::fabs(xerr(ii))/scale);
+    }
+
+      // Step size for the next attempt, or next step if accepted.
+      // Don't grow immediately after a rejected attempt.
+    double factor {max_factor};
+    if (err > 0.0) {
+      factor = std::clamp(safety*std::pow(err, -1.0/8.0),
+                          min_factor, max_factor);
+    }
+    if (rejected) {
+      factor = std::min(factor, 1.0);
+    }
+
+    if (err <= 1.0) {
+      m_jd += dt;
+      m_x = xnew;
+        // Full evaluation - also the first stage of the next step, so
+        // partials cached at the final stage of this one can't be reused
+      m_dx = m_deq->getXdot(m_jd, m_x, OdeEvalMethod::predictor);
+      m_dt *= factor;
+      if (std::fabs(m_dt) > std::fabs(m_dt_max)) {
+        m_dt = m_dt_max;
+      }
+      return m_jd;
+    }
+    rejected = true;
+    m_dt *= factor;
+  }
+}
+
+
+}
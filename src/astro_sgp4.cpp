@@ -9,6 +9,7 @@
 #include <astro_sgp4.h>
 
 #include <array>
+#include <vector>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -22,8 +23,11 @@
 #include <phy_const.h>
 #include <cal_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
 #include <astro_tle.h>
 
 namespace eom {
@@ -90,6 +94,20 @@ std::string Sgp4::getName() const
 
 Eigen::Matrix<double, 6, 1> Sgp4::getStateVector(const JulianDate& jd,
                                                   EphemFrame frame) const
+{
+  elsetrec satrec = m_satrec;
+  Eigen::Matrix<double, 6, 1> xteme = this->propagate(satrec, jd);
+  EcfEciTransform f2i {m_ecfeci->getTransform(jd)};
+
+  if (frame == EphemFrame::eci) {
+    return f2i.teme2eci(xteme.block<3,1>(0,0), xteme.block<3,1>(3,0));
+  }
+  return f2i.teme2ecf(xteme.block<3,1>(0,0), xteme.block<3,1>(3,0));
+}
+
+
+Eigen::Matrix<double, 3, 1> Sgp4::getPosition(const JulianDate& jd,
+                                               EphemFrame frame) const
 {
   double delta_t {cal_const::min_per_day*(jd - m_jd0)};
   std::array<double, 3> pos;
@@ -97,44 +115,82 @@ Eigen::Matrix<double, 6, 1> Sgp4::getStateVector(const JulianDate& jd,
   elsetrec satrec = m_satrec;
   SGP4Funcs::sgp4(satrec, delta_t, pos.data(), vel.data());
 
-  Eigen::Matrix<double, 6, 1> xteme;
+  Eigen::Matrix<double, 3, 1> xteme;
   xteme(0) = phy_const::du_per_km*pos[0];
   xteme(1) = phy_const::du_per_km*pos[1];
   xteme(2) = phy_const::du_per_km*pos[2];
-  xteme(3) = phy_const::du_per_km*vel[0]*phy_const::sec_per_tu;
-  xteme(4) = phy_const::du_per_km*vel[1]*phy_const::sec_per_tu;
-  xteme(5) = phy_const::du_per_km*vel[2]*phy_const::sec_per_tu;
-  Eigen::Matrix<double, 6, 1> xecf = m_ecfeci->teme2ecf(jd,
-                                                        xteme.block<3,1>(0,0),
-                                                        xteme.block<3,1>(3,0));
+
+  EcfEciTransform f2i {m_ecfeci->getTransform(jd)};
 
   if (frame == EphemFrame::eci) {
-    return m_ecfeci->ecf2eci(jd, xecf.block<3,1>(0,0), xecf.block<3,1>(3,0));
+    return f2i.teme2eci(xteme);
   }
-  return xecf;
+  return f2i.teme2ecf(xteme);
 }
 
 
-Eigen::Matrix<double, 3, 1> Sgp4::getPosition(const JulianDate& jd,
-                                               EphemFrame frame) const
+void Sgp4::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "Sgp4");
+
+  elsetrec satrec = m_satrec;
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    xvec.col(ii) = this->propagate(satrec, jd[ii]);
+  }
+
+  if (frame == EphemFrame::eci) {
+    m_ecfeci->teme2eci(jd, xvec, xvec);
+  } else {
+    m_ecfeci->teme2ecf(jd, xvec, xvec);
+  }
+}
+
+
+void Sgp4::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "Sgp4");
+
+  double dt_days {dt.getDays()};
+  elsetrec satrec = m_satrec;
+  EcfEciCursor f2i {m_ecfeci};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+    xvec.col(ii) = this->propagate(satrec, jd);
+    EcfEciTransform f2i_now {f2i.getTransform(jd)};
+    if (frame == EphemFrame::eci) {
+      xvec.col(ii) = f2i_now.teme2eci(xvec.block<3,1>(0,ii),
+                                      xvec.block<3,1>(3,ii));
+    } else {
+      xvec.col(ii) = f2i_now.teme2ecf(xvec.block<3,1>(0,ii),
+                                      xvec.block<3,1>(3,ii));
+    }
+  }
+}
+
+
+Eigen::Matrix<double, 6, 1> Sgp4::propagate(elsetrec& satrec,
+                                            const JulianDate& jd) const
 {
   double delta_t {cal_const::min_per_day*(jd - m_jd0)};
   std::array<double, 3> pos;
   std::array<double, 3> vel;
-  elsetrec satrec = m_satrec;
   SGP4Funcs::sgp4(satrec, delta_t, pos.data(), vel.data());
 
-  Eigen::Matrix<double, 3, 1> xteme;
+  Eigen::Matrix<double, 6, 1> xteme;
   xteme(0) = phy_const::du_per_km*pos[0];
   xteme(1) = phy_const::du_per_km*pos[1];
   xteme(2) = phy_const::du_per_km*pos[2];
+  xteme(3) = phy_const::du_per_km*vel[0]*phy_const::sec_per_tu;
+  xteme(4) = phy_const::du_per_km*vel[1]*phy_const::sec_per_tu;
+  xteme(5) = phy_const::du_per_km*vel[2]*phy_const::sec_per_tu;
 
-  Eigen::Matrix<double, 3, 1> xecf = m_ecfeci->teme2ecf(jd, xteme);
-
-  if (frame == EphemFrame::eci) {
-    return m_ecfeci->ecf2eci(jd, xecf);
-  }
-  return xecf;
+  return xteme;
 }
 
 
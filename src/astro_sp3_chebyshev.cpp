@@ -19,8 +19,11 @@
 
 #include <phy_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <astro_granule.h>
 #include <astro_ephemeris.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
 #include <mth_index_mapper.h>
 
 namespace eom {
@@ -119,4 +122,72 @@ Sp3Chebyshev::getPosition(const JulianDate& jd, EphemFrame frame) const
 }
 
 
+void Sp3Chebyshev::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "Sp3Chebyshev");
+
+  unsigned long ndx {0UL};
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    try {
+      ndx = m_ndxr->getIndex(jd[ii], ndx);
+    } catch (const std::out_of_range& ia) {
+      throw std::out_of_range("Sp3Chebyshev::getStateVectors() - bad time");
+    }
+    const auto& irec = m_eph_interpolators[ndx];
+    xvec.block<3,1>(0,ii) = irec.tItp.getPosition(jd[ii]);
+    xvec.block<3,1>(3,ii) = irec.tItp.getVelocity(jd[ii]);
+  }
+
+  if (frame == EphemFrame::eci) {
+    m_ecfeciSys->ecf2eci(jd, xvec, xvec);
+  }
+}
+
+
+void Sp3Chebyshev::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "Sp3Chebyshev");
+  if (n == 0UL) {
+    return;
+  }
+
+  unsigned long ndx {};
+  try {
+    ndx = m_ndxr->getIndex(start);
+  } catch (const std::out_of_range& ia) {
+    throw std::out_of_range("Sp3Chebyshev::sample() - bad time");
+  }
+  const unsigned long nrec {m_eph_interpolators.size()};
+  const double dt_days {dt.getDays()};
+  EcfEciCursor f2i {m_ecfeciSys};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+      // Step to the record containing jd
+    while (ndx + 1UL < nrec  &&  m_eph_interpolators[ndx].jd2 < jd) {
+      ndx++;
+    }
+    while (ndx > 0UL  &&  jd < m_eph_interpolators[ndx].jd1) {
+      ndx--;
+    }
+    const auto& irec = m_eph_interpolators[ndx];
+    if (jd < irec.jd1  ||  irec.jd2 < jd) {
+      throw std::out_of_range("Sp3Chebyshev::sample() - bad time");
+    }
+    xvec.block<3,1>(0,ii) = irec.tItp.getPosition(jd);
+    xvec.block<3,1>(3,ii) = irec.tItp.getVelocity(jd);
+
+    if (frame == EphemFrame::eci) {
+      xvec.col(ii) = f2i.getTransform(jd).ecf2eci(xvec.block<3,1>(0,ii),
+                                                  xvec.block<3,1>(3,ii));
+    }
+  }
+}
+
+
 }
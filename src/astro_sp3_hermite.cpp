@@ -19,8 +19,11 @@
 
 #include <phy_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <mth_hermite2.h>
 #include <astro_ephemeris.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
 #include <astro_gravity_jn.h>
 #include <mth_index_mapper.h>
 
@@ -118,4 +121,74 @@ Eigen::Matrix<double, 3, 1> Sp3Hermite::getPosition(const JulianDate& jd,
 }
 
 
+void Sp3Hermite::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "Sp3Hermite");
+
+  unsigned long ndx {0UL};
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    try {
+      ndx = m_ndxr->getIndex(jd[ii], ndx);
+    } catch (const std::out_of_range& ia) {
+      throw std::out_of_range("Sp3Hermite::getStateVectors() - bad time");
+    }
+    const auto& irec = m_eph_interpolators[ndx];
+    double dt_tu {phy_const::tu_per_day*(jd[ii] - irec.jd1)};
+    xvec.block<3,1>(0,ii) = irec.hItp.getPosition(dt_tu);
+    xvec.block<3,1>(3,ii) = irec.hItp.getVelocity(dt_tu);
+  }
+
+  if (frame == EphemFrame::eci) {
+    m_ecfeciSys->ecf2eci(jd, xvec, xvec);
+  }
+}
+
+
+void Sp3Hermite::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "Sp3Hermite");
+  if (n == 0UL) {
+    return;
+  }
+
+  unsigned long ndx {};
+  try {
+    ndx = m_ndxr->getIndex(start);
+  } catch (const std::out_of_range& ia) {
+    throw std::out_of_range("Sp3Hermite::sample() - bad time");
+  }
+  const unsigned long nrec {m_eph_interpolators.size()};
+  const double dt_days {dt.getDays()};
+  EcfEciCursor f2i {m_ecfeciSys};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+      // Step to the record containing jd
+    while (ndx + 1UL < nrec  &&  m_eph_interpolators[ndx].jd2 < jd) {
+      ndx++;
+    }
+    while (ndx > 0UL  &&  jd < m_eph_interpolators[ndx].jd1) {
+      ndx--;
+    }
+    const auto& irec = m_eph_interpolators[ndx];
+    if (jd < irec.jd1  ||  irec.jd2 < jd) {
+      throw std::out_of_range("Sp3Hermite::sample() - bad time");
+    }
+    double dt_tu {phy_const::tu_per_day*(jd - irec.jd1)};
+    xvec.block<3,1>(0,ii) = irec.hItp.getPosition(dt_tu);
+    xvec.block<3,1>(3,ii) = irec.hItp.getVelocity(dt_tu);
+
+    if (frame == EphemFrame::eci) {
+      xvec.col(ii) = f2i.getTransform(jd).ecf2eci(xvec.block<3,1>(0,ii),
+                                                  xvec.block<3,1>(3,ii));
+    }
+  }
+}
+
+
 }
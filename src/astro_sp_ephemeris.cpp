@@ -8,11 +8,22 @@
 
 #include <astro_sp_ephemeris.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <utility>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
+#include <future>
 
 #include <Eigen/Dense>
 
@@ -21,105 +32,660 @@
 #include <cal_duration.h>
 #include <cal_julian_date.h>
 #include <mth_hermite2.h>
+#include <mth_hermite2_table.h>
+#include <mth_index_mapper.h>
 #include <mth_ode_solver.h>
 #include <astro_ephemeris.h>
-#include <mth_index_mapper.h>
+#include <astro_ephemeris_binary.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
 
 namespace eom {
 
+  // Compact storage error tolerances, position and velocity
+static constexpr double compact_pos_tol {phy_const::du_per_m};
+static constexpr double compact_vel_tol {0.01*phy_const::du_per_m/
+                                              phy_const::tu_per_sec};
+
 SpEphemeris::SpEphemeris(const std::string& name,
                          const JulianDate& jdStart,
                          const JulianDate& jdStop,
                          std::shared_ptr<const EcfEciSys> ecfeciSys,
-                         std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp)
+                         std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp,
+                         std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp_back,
+                         bool ecf_interp,
+                         bool compact)
 {
   m_name = name;
   m_jdStart = jdStart;
   m_jdStop = jdStop;
   m_ecfeciSys = std::move(ecfeciSys);
+  m_ecf_interp = ecf_interp;
+  m_compact = compact;
+  m_jdEpoch = sp->getT();
 
-    // SP propagator
-  std::unique_ptr<OdeSolver<JulianDate, double, 6>> c_sp = std::move(sp);
-  m_jdEpoch = c_sp->getT();
+    // Pad start and stop times
+  m_jdBeginProp = m_jdStart + -utl_const::day_per_min;
+  m_jdEndProp = m_jdStop + utl_const::day_per_min;
 
-    // Pad stop time
-  JulianDate jdEndProp {m_jdStop + utl_const::day_per_min};
-  JulianDate jdNow = c_sp->getT();
+    // Backward ephemeris, generated concurrently with forward
+  std::future<std::vector<eph_record>> bwd_leg;
+  if (sp_back != nullptr) {
+    bwd_leg = std::async(std::launch::async,
+                         [jdEnd = m_jdBeginProp, sp = std::move(sp_back)]() {
+                           return propagate(*sp, jdEnd, false);
+                         });
+  }
 
     // Forward ephemeris
-  std::vector<eph_record> fwd_eph;
-  Eigen::Matrix<double, 6, 1> c_x = c_sp->getX();
-  Eigen::Matrix<double, 6, 1> c_dx = c_sp->getXdot();
-  fwd_eph.emplace_back(jdNow, c_x.block<3, 1>(0, 0),
-                              c_x.block<3, 1>(3, 0),
-                              c_dx.block<3, 1>(3, 0));
-  while (jdNow < jdEndProp) {
-    jdNow = c_sp->step();
-    c_x = c_sp->getX();
-    c_dx = c_sp->getXdot();
-    fwd_eph.emplace_back(jdNow, c_x.block<3, 1>(0, 0),
-                                c_x.block<3, 1>(3, 0),
-                                c_dx.block<3, 1>(3, 0));
-  }
-
-  std::vector<std::pair<JulianDate, JulianDate>> times;
-    // Generate and store Hermite interpolation objects
-  for (unsigned long ii=1UL; ii<fwd_eph.size(); ++ii) {
-    eph_record& r1 = fwd_eph[ii-1UL];
-    eph_record& r2 = fwd_eph[ii];
+  std::vector<eph_record> eph = propagate(*sp, m_jdEndProp, true);
+
+    // Prepend backward ephemeris in increasing time order, excluding the
+    // epoch record shared with the forward leg
+  if (bwd_leg.valid()) {
+    std::vector<eph_record> bwd_eph = bwd_leg.get();
+    eph.insert(eph.begin(), bwd_eph.rbegin(), bwd_eph.rend() - 1);
+  }
+  if (eph.size() < 2) {
+    throw std::invalid_argument(
+        "SpEphemeris::SpEphemeris() No ephemeris within span: " + m_name);
+  }
+
+  m_segment = this->buildSegment(eph);
+}
+
+
+SpEphemeris::SpEphemeris(const std::string& name,
+                         const JulianDate& jdStart,
+                         const JulianDate& jdStop,
+                         const JulianDate& jdEpoch,
+                         std::shared_ptr<const EcfEciSys> ecfeciSys,
+                         std::vector<eph_record>& eph,
+                         bool ecf_interp,
+                         bool compact)
+{
+  m_name = name;
+  m_jdStart = jdStart;
+  m_jdStop = jdStop;
+  m_ecfeciSys = std::move(ecfeciSys);
+  m_ecf_interp = ecf_interp;
+  m_compact = compact;
+  m_jdEpoch = jdEpoch;
+
+  m_jdBeginProp = m_jdStart + -utl_const::day_per_min;
+  m_jdEndProp = m_jdStop + utl_const::day_per_min;
+
+  if (eph.size() < 2) {
+    throw std::invalid_argument(
+        "SpEphemeris::SpEphemeris() No ephemeris within span: " + m_name);
+  }
+
+  m_segment = this->buildSegment(eph);
+}
+
+
+SpEphemeris::SpEphemeris(const std::string& name,
+                         const JulianDate& jdStart,
+                         const JulianDate& jdStop,
+                         std::shared_ptr<const EcfEciSys> ecfeciSys,
+                         std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp,
+                         std::unique_ptr<OdeSolver<JulianDate, double, 6>> sp_back,
+                         const Duration& seg,
+                         unsigned long max_segments,
+                         SpSolverFactory regen,
+                         bool ecf_interp,
+                         bool compact)
+{
+  if (seg.getDays() <= 0.0) {
+    throw std::invalid_argument(
+        "SpEphemeris::SpEphemeris() Segment duration must be positive");
+  }
+  m_name = name;
+  m_jdStart = jdStart;
+  m_jdStop = jdStop;
+  m_ecfeciSys = std::move(ecfeciSys);
+  m_ecf_interp = ecf_interp;
+  m_compact = compact;
+  m_jdEpoch = sp->getT();
+
+    // Pad start and stop times
+  m_jdBeginProp = m_jdStart + -utl_const::day_per_min;
+  m_jdEndProp = m_jdStop + utl_const::day_per_min;
+
+  m_lazy = std::make_unique<sp_lazy>();
+  m_lazy->seg_days = seg.getDays();
+  if (regen != nullptr) {
+    m_lazy->max_segments = max_segments;
+    m_lazy->regen = std::move(regen);
+  }
+
+    // Number of segments spanning each leg, the last one being clipped
+    // to the padded end of the ephemeris
+  std::array<double, 2> span_days {m_jdEndProp - m_jdEpoch,
+                                   m_jdEpoch - m_jdBeginProp};
+  m_lazy->legs[0].sp = std::move(sp);
+  m_lazy->legs[1].sp = std::move(sp_back);
+  for (unsigned long ii=0UL; ii<m_lazy->legs.size(); ++ii) {
+    sp_leg& leg = m_lazy->legs[ii];
+    leg.forward = ii == 0UL;
+    if (leg.sp == nullptr  ||  span_days[ii] <= 0.0) {
+      continue;
+    }
+    leg.nseg = static_cast<unsigned long>(
+                   std::ceil(span_days[ii]/m_lazy->seg_days));
+    leg.segments.reserve(leg.nseg);
+    leg.bounds.reserve(leg.nseg + 1UL);
+    Eigen::Matrix<double, 6, 1> c_x = leg.sp->getX();
+    Eigen::Matrix<double, 6, 1> c_dx = leg.sp->getXdot();
+    leg.bounds.emplace_back(leg.sp->getT(), c_x.block<3, 1>(0, 0),
+                                            c_x.block<3, 1>(3, 0),
+                                            c_dx.block<3, 1>(3, 0));
+  }
+}
+
+
+std::vector<eph_record>
+SpEphemeris::propagate(OdeSolver<JulianDate, double, 6>& sp,
+                       JulianDate jdEnd, bool forward)
+{
+  std::vector<eph_record> eph;
+  JulianDate jdNow = sp.getT();
+  Eigen::Matrix<double, 6, 1> c_x = sp.getX();
+  Eigen::Matrix<double, 6, 1> c_dx = sp.getXdot();
+  eph.emplace_back(jdNow, c_x.block<3, 1>(0, 0),
+                          c_x.block<3, 1>(3, 0),
+                          c_dx.block<3, 1>(3, 0));
+  while (forward ? jdNow < jdEnd : jdEnd < jdNow) {
+    JulianDate jdLast {jdNow};
+    jdNow = sp.step();
+    if (forward ? !(jdLast < jdNow) : !(jdNow < jdLast)) {
+      throw std::runtime_error(
+          "SpEphemeris::propagate() Integrator not stepping toward end time");
+    }
+    c_x = sp.getX();
+    c_dx = sp.getXdot();
+    eph.emplace_back(jdNow, c_x.block<3, 1>(0, 0),
+                            c_x.block<3, 1>(3, 0),
+                            c_dx.block<3, 1>(3, 0));
+  }
+
+  return eph;
+}
+
+
+std::shared_ptr<const SpEphemeris::sp_segment>
+SpEphemeris::buildSegment(std::vector<eph_record>& eph) const
+{
+  auto seg = std::make_shared<sp_segment>();
+  seg->compact = m_compact;
+  seg->ecf = m_ecf_interp;
+  seg->times.reserve(eph.size());
+  for (const auto& rec : eph) {
+    seg->times.push_back(rec.t);
+  }
+  std::vector<std::pair<JulianDate, JulianDate>> blocks;
+  blocks.reserve(eph.size() - 1UL);
+  for (unsigned long ii=1UL; ii<eph.size(); ++ii) {
+    blocks.emplace_back(eph[ii-1UL].t, eph[ii].t);
+  }
+  seg->ndxr = std::make_unique<IndexMapper<JulianDate>>(std::move(blocks));
+
+    // Generate and store Hermite interpolation polynomials
+  seg->eph_interpolators.reserve(m_compact ? 0UL : eph.size() - 1UL);
+  seg->eph_compact.reserve(m_compact ? eph.size() - 1UL : 0UL);
+  for (unsigned long ii=1UL; ii<eph.size(); ++ii) {
+    eph_record& r1 = eph[ii-1UL];
+    eph_record& r2 = eph[ii];
+    double dt_tu {phy_const::tu_per_day*(r2.t - r1.t)};
+    Hermite2<double, 3> hItp(dt_tu,
+                             r1.p, r1.v, r1.a,
+                             r2.p, r2.v, r2.a,
+                             phy_const::epsdt);
+    seg->push_back(false, hItp);
+  }
+
+  if (m_ecf_interp) {
+    this->buildEcfInterpolators(*seg, eph);
+  }
+
+  if (m_compact) {
+    double pos_err {std::max(seg->eph_compact.getMaxPositionError(),
+                             seg->ecf_compact.getMaxPositionError())};
+    double vel_err {std::max(seg->eph_compact.getMaxVelocityError(),
+                             seg->ecf_compact.getMaxVelocityError())};
+    if (pos_err > compact_pos_tol  ||  vel_err > compact_vel_tol) {
+      throw std::runtime_error(
+          "SpEphemeris::buildSegment() Compact storage error bound exceeded: "
+          + m_name);
+    }
+  }
+
+  return seg;
+}
+
+
+void SpEphemeris::buildEcfInterpolators(sp_segment& seg,
+                                        std::vector<eph_record>& eph) const
+{
+    // Convert each record to ECF - acceleration w.r.t. ECF includes
+    // Coriolis and centripetal terms
+  EcfEciCursor f2i {m_ecfeciSys};
+  for (auto& rec : eph) {
+    EcfEciTransform f2i_now {f2i.getTransform(rec.t)};
+    Eigen::Matrix<double, 6, 1> xecf = f2i_now.eci2ecf(rec.p, rec.v);
+    rec.p = xecf.block<3,1>(0,0);
+    rec.v = xecf.block<3,1>(3,0);
+    rec.a = f2i_now.gravity2ecf(rec.p, rec.v, f2i_now.eci2ecf(rec.a));
+  }
+
+  seg.ecf_interpolators.reserve(m_compact ? 0UL : eph.size() - 1UL);
+  seg.ecf_compact.reserve(m_compact ? eph.size() - 1UL : 0UL);
+  for (unsigned long ii=1UL; ii<eph.size(); ++ii) {
+    const eph_record& r1 = eph[ii-1UL];
+    const eph_record& r2 = eph[ii];
     double dt_tu {phy_const::tu_per_day*(r2.t - r1.t)};
     Hermite2<double, 3> hItp(dt_tu,
                              r1.p, r1.v, r1.a,
                              r2.p, r2.v, r2.a,
                              phy_const::epsdt);
-    m_eph_interpolators.emplace_back(r1.t, r2.t, hItp);
-    times.emplace_back(r1.t, r2.t);
+    seg.push_back(true, hItp);
+  }
+}
+
+
+unsigned long SpEphemeris::sp_segment::locate(const JulianDate& jd,
+                                              unsigned long hint) const
+{
+  return ndxr->getIndex(jd, hint);
+}
+
+
+const SpEphemeris::sp_segment&
+SpEphemeris::segment(const JulianDate& jd,
+                     std::shared_ptr<const sp_segment>& hold) const
+{
+  if (m_lazy == nullptr) {
+    return *m_segment;
+  }
+  hold = this->lazySegment(jd);
+  return *hold;
+}
+
+
+std::shared_ptr<const SpEphemeris::sp_segment>
+SpEphemeris::lazySegment(const JulianDate& jd) const
+{
+  if (jd < m_jdBeginProp  ||  m_jdEndProp < jd) {
+    throw std::out_of_range("SpEphemeris::lazySegment() - bad time");
+  }
+  sp_lazy& lazy = *m_lazy;
+  bool forward {!(jd < m_jdEpoch)};
+  if (forward  &&  lazy.legs[0].nseg == 0UL) {
+    forward = false;
+  }
+  sp_leg& leg = forward ? lazy.legs[0] : lazy.legs[1];
+  if (leg.nseg == 0UL) {
+    throw std::out_of_range("SpEphemeris::lazySegment() - bad time");
+  }
+  auto k = static_cast<unsigned long>(std::abs(jd - m_jdEpoch)/lazy.seg_days);
+  k = std::min(k, leg.nseg - 1UL);
+
+    // Integration steps overrun nominal segment boundaries, so the
+    // preceding segment may hold jd
+  for (;;) {
+    std::shared_ptr<const sp_segment> seg {nullptr};
+    {
+      std::shared_lock<std::shared_mutex> lock {lazy.mtx};
+      if (k < leg.segments.size()) {
+        seg = leg.segments[k];
+      }
+    }
+    if (seg == nullptr) {
+      std::unique_lock<std::shared_mutex> lock {lazy.mtx};
+      this->generate(leg, k);
+      seg = leg.segments[k];
+    }
+    if (seg->covers(jd)  ||  k == 0UL) {
+      return seg;
+    }
+    k--;
+  }
+}
+
+
+void SpEphemeris::generate(sp_leg& leg, unsigned long k) const
+{
+  sp_lazy& lazy = *m_lazy;
+
+    // Extend from the last segment generated
+  while (leg.segments.size() <= k) {
+    unsigned long ndx {leg.segments.size()};
+    std::vector<eph_record> eph = propagate(*leg.sp,
+                                            this->segmentEnd(leg, ndx),
+                                            leg.forward);
+    leg.bounds.push_back(eph.back());
+    if (!leg.forward) {
+      std::reverse(eph.begin(), eph.end());
+    }
+    leg.segments.push_back(this->buildSegment(eph));
+    lazy.resident++;
+    this->release(leg, k);
+  }
+
+    // Regenerate a released segment from its starting state
+  if (leg.segments[k] == nullptr) {
+    const eph_record& r0 = leg.bounds[k];
+    Eigen::Matrix<double, 6, 1> x0;
+    x0.block<3,1>(0,0) = r0.p;
+    x0.block<3,1>(3,0) = r0.v;
+    auto sp = lazy.regen(r0.t, x0, leg.forward);
+    if (sp == nullptr) {
+      throw std::runtime_error(
+          "SpEphemeris::generate() Unable to regenerate segment: " + m_name);
+    }
+    std::vector<eph_record> eph = propagate(*sp, this->segmentEnd(leg, k),
+                                            leg.forward);
+    if (!leg.forward) {
+      std::reverse(eph.begin(), eph.end());
+    }
+    leg.segments[k] = this->buildSegment(eph);
+    lazy.resident++;
+    this->release(leg, k);
+  }
+}
+
+
+void SpEphemeris::release(const sp_leg& leg, unsigned long k) const
+{
+  sp_lazy& lazy = *m_lazy;
+  if (lazy.max_segments == 0UL) {
+    return;
+  }
+
+    // Segments ordered by time: backward legs at negative positions
+  auto position = [](const sp_leg& sl, unsigned long ndx) {
+    auto pos = static_cast<long>(ndx);
+    return sl.forward ? pos : -pos - 1L;
+  };
+  long keep {position(leg, k)};
+  while (lazy.resident > lazy.max_segments) {
+    std::shared_ptr<const sp_segment>* furthest {nullptr};
+    long max_dist {0L};
+    for (auto& sl : lazy.legs) {
+      for (unsigned long ii=0UL; ii<sl.segments.size(); ++ii) {
+        long dist {std::abs(position(sl, ii) - keep)};
+        if (sl.segments[ii] != nullptr  &&  dist > max_dist) {
+          max_dist = dist;
+          furthest = &sl.segments[ii];
+        }
+      }
+    }
+    if (furthest == nullptr) {
+      return;
+    }
+    furthest->reset();
+    lazy.resident--;
+  }
+}
+
+
+JulianDate SpEphemeris::segmentEnd(const sp_leg& leg, unsigned long k) const
+{
+  if (k + 1UL >= leg.nseg) {
+    return leg.forward ? m_jdEndProp : m_jdBeginProp;
+  }
+  double dt_days {(k + 1UL)*m_lazy->seg_days};
+  return leg.forward ? m_jdEpoch + dt_days : m_jdEpoch + -dt_days;
+}
+
+
+void SpEphemeris::write(const std::string& fname) const
+{
+    // Segments in increasing time order, held so none are released
+    // while writing
+  std::vector<std::shared_ptr<const sp_segment>> segs;
+  if (m_lazy == nullptr) {
+    segs.push_back(m_segment);
+  } else {
+    std::unique_lock<std::shared_mutex> lock {m_lazy->mtx};
+    sp_leg& fwd = m_lazy->legs[0];
+    sp_leg& bwd = m_lazy->legs[1];
+    for (unsigned long ii=0UL; ii<bwd.nseg; ++ii) {
+      this->generate(bwd, ii);
+      segs.push_back(bwd.segments[ii]);
+    }
+    std::reverse(segs.begin(), segs.end());
+    for (unsigned long ii=0UL; ii<fwd.nseg; ++ii) {
+      this->generate(fwd, ii);
+      segs.push_back(fwd.segments[ii]);
+    }
+  }
+
+    // Merge node times - adjacent segments share a boundary node
+  std::vector<double> times;
+  double max_pos_err {0.0};
+  double max_vel_err {0.0};
+  for (const auto& seg : segs) {
+    auto first = seg->times.begin();
+    if (!times.empty()) {
+      if (times[times.size() - 2] != first->getJdHigh()  ||
+          times.back() != first->getJdLow()) {
+        throw std::runtime_error(
+            "SpEphemeris::write() Noncontiguous segments: " + m_name);
+      }
+      ++first;
+    }
+    for (auto it = first; it != seg->times.end(); ++it) {
+      times.push_back(it->getJdHigh());
+      times.push_back(it->getJdLow());
+    }
+    max_pos_err = std::max({max_pos_err,
+                            seg->eph_compact.getMaxPositionError(),
+                            seg->ecf_compact.getMaxPositionError()});
+    max_vel_err = std::max({max_vel_err,
+                            seg->eph_compact.getMaxVelocityError(),
+                            seg->ecf_compact.getMaxVelocityError()});
+  }
+
+  eph_binary::header hdr {};
+  std::memcpy(hdr.magic, eph_binary::magic, sizeof(eph_binary::magic));
+  hdr.version = eph_binary::version;
+  hdr.byte_order = eph_binary::byte_order;
+  hdr.coeff_bytes = m_compact ? sizeof(float) : sizeof(double);
+  hdr.nframes = m_ecf_interp ? 2 : 1;
+  hdr.block_bytes = m_compact ? Hermite2Table<double, 3, float>::blockSize() :
+                                Hermite2Table<double, 3>::blockSize();
+  hdr.nnodes = times.size()/2;
+  hdr.times_offset = eph_binary::aligned(sizeof(hdr));
+  std::uint64_t coeff_bytes {(hdr.nnodes - 1)*hdr.block_bytes};
+  hdr.coeff_offset[0] =
+      eph_binary::aligned(hdr.times_offset + times.size()*sizeof(double));
+  hdr.coeff_offset[1] = m_ecf_interp ?
+      eph_binary::aligned(hdr.coeff_offset[0] + coeff_bytes) : 0;
+  hdr.epoch[0] = m_jdEpoch.getJdHigh();
+  hdr.epoch[1] = m_jdEpoch.getJdLow();
+  hdr.start[0] = m_jdStart.getJdHigh();
+  hdr.start[1] = m_jdStart.getJdLow();
+  hdr.stop[0] = m_jdStop.getJdHigh();
+  hdr.stop[1] = m_jdStop.getJdLow();
+  hdr.max_pos_err = max_pos_err;
+  hdr.max_vel_err = max_vel_err;
+
+    // Write to a unique temporary file and rename so readers never map
+    // a partially written file
+  std::ostringstream tmp_name;
+  tmp_name << fname << '.' << std::hex << std::random_device{}();
+  std::ofstream fout(tmp_name.str(), std::ios::binary);
+  if (!fout.is_open()) {
+    throw std::runtime_error("SpEphemeris::write() Can't open " + fname);
+  }
+  const char zeros[eph_binary::alignment] {};
+  auto pad_to = [&fout, &zeros](std::uint64_t offset) {
+    auto pos = static_cast<std::uint64_t>(fout.tellp());
+    fout.write(zeros, static_cast<std::streamsize>(offset - pos));
+  };
+  fout.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+  pad_to(hdr.times_offset);
+  fout.write(reinterpret_cast<const char*>(times.data()),
+             static_cast<std::streamsize>(times.size()*sizeof(double)));
+  for (unsigned int frame=0; frame<hdr.nframes; ++frame) {
+    pad_to(hdr.coeff_offset[frame]);
+    for (const auto& seg : segs) {
+      const void* data {nullptr};
+      unsigned long n {0UL};
+      if (m_compact) {
+        const auto& tbl = (frame == 0) ? seg->eph_compact : seg->ecf_compact;
+        data = tbl.data();
+        n = tbl.size();
+      } else {
+        const auto& tbl = (frame == 0) ? seg->eph_interpolators :
+                                         seg->ecf_interpolators;
+        data = tbl.data();
+        n = tbl.size();
+      }
+      fout.write(static_cast<const char*>(data),
+                 static_cast<std::streamsize>(n*hdr.block_bytes));
+    }
+  }
+  fout.close();
+  if (fout.fail()  ||
+      std::rename(tmp_name.str().c_str(), fname.c_str())) {
+    std::remove(tmp_name.str().c_str());
+    throw std::runtime_error("SpEphemeris::write() Can't write " + fname);
   }
-  m_ndxr = std::make_unique<IndexMapper<JulianDate>>(times);
 }
 
 
 Eigen::Matrix<double, 6, 1> SpEphemeris::getStateVector(const JulianDate& jd,
                                                         EphemFrame frame) const
 {
+  std::shared_ptr<const sp_segment> hold {nullptr};
+  const sp_segment* seg {nullptr};
   unsigned long ndx {};
   try {
-    ndx = m_ndxr->getIndex(jd);
+    seg = &this->segment(jd, hold);
+    ndx = seg->locate(jd, 0UL);
   } catch (const std::out_of_range& ia) {
     throw std::out_of_range("SpEphemeris::getStateVector() - bad time");
   }
-  const auto& irec = m_eph_interpolators[ndx];
-  double dt_tu {phy_const::tu_per_day*(jd - irec.jd1)};
-  Eigen::Matrix<double, 6, 1> xeci;
-  xeci.block<3,1>(0,0) = irec.hItp.getPosition(dt_tu);
-  xeci.block<3,1>(3,0) = irec.hItp.getVelocity(dt_tu);
+  bool native {frame == EphemFrame::eci  ||  m_ecf_interp};
+  double dt_tu {phy_const::tu_per_day*(jd - seg->times[ndx])};
+  Eigen::Matrix<double, 6, 1> xvec;
+  xvec.block<3,1>(0,0) = seg->getPosition(frame, ndx, dt_tu);
+  xvec.block<3,1>(3,0) = seg->getVelocity(frame, ndx, dt_tu);
 
-  if (frame == EphemFrame::ecf) {
-    return m_ecfeciSys->eci2ecf(jd, xeci.block<3,1>(0,0), xeci.block<3,1>(3,0));
+  if (!native) {
+    return m_ecfeciSys->eci2ecf(jd, xvec.block<3,1>(0,0), xvec.block<3,1>(3,0));
   }
 
-  return xeci;
+  return xvec;
 }
 
 
 Eigen::Matrix<double, 3, 1> SpEphemeris::getPosition(const JulianDate& jd,
                                                      EphemFrame frame) const
 {
+  std::shared_ptr<const sp_segment> hold {nullptr};
+  const sp_segment* seg {nullptr};
   unsigned long ndx {};
   try {
-    ndx = m_ndxr->getIndex(jd);
+    seg = &this->segment(jd, hold);
+    ndx = seg->locate(jd, 0UL);
   } catch (const std::out_of_range& ia) {
     throw std::out_of_range("SpEphemeris::getPosition() - bad time");
   }
-  const auto& irec = m_eph_interpolators[ndx];
-  double dt_tu {phy_const::tu_per_day*(jd - irec.jd1)};
-  Eigen::Matrix<double, 3, 1> xeci = irec.hItp.getPosition(dt_tu);
+  bool native {frame == EphemFrame::eci  ||  m_ecf_interp};
+  double dt_tu {phy_const::tu_per_day*(jd - seg->times[ndx])};
+  Eigen::Matrix<double, 3, 1> pos = seg->getPosition(frame, ndx, dt_tu);
 
-  if (frame == EphemFrame::ecf) {
-    return m_ecfeciSys->eci2ecf(jd, xeci);
+  if (!native) {
+    return m_ecfeciSys->eci2ecf(jd, pos);
   }
 
-  return xeci;
+  return pos;
+}
+
+
+void SpEphemeris::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "SpEphemeris");
+
+  bool native {frame == EphemFrame::eci  ||  m_ecf_interp};
+  std::shared_ptr<const sp_segment> hold {nullptr};
+  const sp_segment* seg {nullptr};
+  unsigned long ndx {0UL};
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    try {
+      if (seg == nullptr  ||  !seg->covers(jd[ii])) {
+        seg = &this->segment(jd[ii], hold);
+        ndx = seg->locate(jd[ii], 0UL);
+      } else {
+        ndx = seg->locate(jd[ii], ndx);
+      }
+    } catch (const std::out_of_range& ia) {
+      throw std::out_of_range("SpEphemeris::getStateVectors() - bad time");
+    }
+    double dt_tu {phy_const::tu_per_day*(jd[ii] - seg->times[ndx])};
+    xvec.block<3,1>(0,ii) = seg->getPosition(frame, ndx, dt_tu);
+    xvec.block<3,1>(3,ii) = seg->getVelocity(frame, ndx, dt_tu);
+  }
+
+  if (!native) {
+    m_ecfeciSys->eci2ecf(jd, xvec, xvec);
+  }
+}
+
+
+void SpEphemeris::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "SpEphemeris");
+  if (n == 0UL) {
+    return;
+  }
+
+  bool native {frame == EphemFrame::eci  ||  m_ecf_interp};
+  std::shared_ptr<const sp_segment> hold {nullptr};
+  const sp_segment* seg {nullptr};
+  unsigned long ndx {0UL};
+  const double dt_days {dt.getDays()};
+  EcfEciCursor f2i {m_ecfeciSys};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+      // Locate the segment, then step to the record containing jd
+    if (seg == nullptr  ||  !seg->covers(jd)) {
+      try {
+        seg = &this->segment(jd, hold);
+        ndx = seg->locate(jd, 0UL);
+      } catch (const std::out_of_range& ia) {
+        throw std::out_of_range("SpEphemeris::sample() - bad time");
+      }
+    }
+    const std::vector<JulianDate>& times = seg->times;
+    const unsigned long nitp {times.size() - 1UL};
+    while (ndx + 1UL < nitp  &&  times[ndx+1UL] < jd) {
+      ndx++;
+    }
+    while (ndx > 0UL  &&  jd < times[ndx]) {
+      ndx--;
+    }
+    if (jd < times[ndx]  ||  times[ndx+1UL] < jd) {
+      throw std::out_of_range("SpEphemeris::sample() - bad time");
+    }
+    double dt_tu {phy_const::tu_per_day*(jd - times[ndx])};
+    xvec.block<3,1>(0,ii) = seg->getPosition(frame, ndx, dt_tu);
+    xvec.block<3,1>(3,ii) = seg->getVelocity(frame, ndx, dt_tu);
+
+    if (!native) {
+      xvec.col(ii) = f2i.getTransform(jd).eci2ecf(xvec.block<3,1>(0,ii),
+                                                  xvec.block<3,1>(3,ii));
+    }
+  }
 }
 
 
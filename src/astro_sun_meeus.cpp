@@ -60,7 +60,7 @@ Eigen::Matrix<double, 3, 1> SunMeeus::getPosition(const JulianDate& jd,
     throw std::out_of_range("SunMeeus::getPosition() - bad time");
   }
 
-  auto jdTT = eom::LeapSeconds::getInstance().utc2tt(jd);
+  auto jdTT = m_ecfeci->getLeapSeconds().utc2tt(jd);
   double jdCent {jdTT.getJulianCenturies()};
 
     // Eccentricity of Earth orbit
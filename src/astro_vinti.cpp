@@ -10,6 +10,7 @@
 
 #include <string>
 #include <array>
+#include <vector>
 #include <utility>
 #include <memory>
 
@@ -19,9 +20,12 @@
 
 #include <cal_const.h>
 #include <cal_julian_date.h>
+#include <cal_duration.h>
 #include <phy_const.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_transform.h>
+#include <astro_ecfeci_cursor.h>
 
 namespace eom {
 
@@ -39,12 +43,9 @@ Vinti::Vinti(const std::string& orbit_name,
   m_jd0 = epoch;
   m_ecfeci = std::move(ecfeciSys);
     // A true equator ECI frame is required for propagation
-  Eigen::Matrix<double, 6, 1> xecf = m_ecfeci->eci2ecf(m_jd0,
-                                                       xeci.block<3,1>(0,0),
-                                                       xeci.block<3,1>(3,0));
-  Eigen::Matrix<double, 6, 1> xteme = m_ecfeci->ecf2teme(m_jd0,
-                                                         xecf.block<3,1>(0,0),
-                                                         xecf.block<3,1>(3,0));
+  Eigen::Matrix<double, 6, 1> xteme =
+      m_ecfeci->getTransform(m_jd0).eci2teme(xeci.block<3,1>(0,0),
+                                             xeci.block<3,1>(3,0));
   m_x0[0] = phy_const::km_per_du*xteme(0);
   m_x0[1] = phy_const::km_per_du*xteme(1);
   m_x0[2] = phy_const::km_per_du*xteme(2);
@@ -56,48 +57,97 @@ Vinti::Vinti(const std::string& orbit_name,
 
 Eigen::Matrix<double, 6, 1> Vinti::getStateVector(const JulianDate& jd,
                                                   EphemFrame frame) const
+{
+  Eigen::Matrix<double, 6, 1> xteme = this->propagate(jd);
+  EcfEciTransform f2i {m_ecfeci->getTransform(jd)};
+
+  if (frame == EphemFrame::eci) {
+    return f2i.teme2eci(xteme.block<3,1>(0,0), xteme.block<3,1>(3,0));
+  }
+  return f2i.teme2ecf(xteme.block<3,1>(0,0), xteme.block<3,1>(3,0));
+}
+
+
+Eigen::Matrix<double, 3, 1> Vinti::getPosition(const JulianDate& jd,
+                                               EphemFrame frame) const
 {
   std::array<double, 6> oe;
   std::array<double, 6> x1;
   double t1 {cal_const::sec_per_day*(jd - m_jd0)};
   Vinti6(m_planet.data(), 0.0, m_x0.data(), t1, x1.data(), oe.data());
 
-  Eigen::Matrix<double, 6, 1> xteme;
+  Eigen::Matrix<double, 3, 1> xteme;
   xteme(0) = phy_const::du_per_km*x1[0];
   xteme(1) = phy_const::du_per_km*x1[1];
   xteme(2) = phy_const::du_per_km*x1[2];
-  xteme(3) = phy_const::du_per_km*x1[3]*phy_const::sec_per_tu;
-  xteme(4) = phy_const::du_per_km*x1[4]*phy_const::sec_per_tu;
-  xteme(5) = phy_const::du_per_km*x1[5]*phy_const::sec_per_tu;
-  Eigen::Matrix<double, 6, 1> xecf = m_ecfeci->teme2ecf(jd,
-                                                        xteme.block<3,1>(0,0),
-                                                        xteme.block<3,1>(3,0));
+  EcfEciTransform f2i {m_ecfeci->getTransform(jd)};
 
   if (frame == EphemFrame::eci) {
-    return m_ecfeci->ecf2eci(jd, xecf.block<3,1>(0,0), xecf.block<3,1>(3,0));
+    return f2i.teme2eci(xteme);
   }
-  return xecf;
+  return f2i.teme2ecf(xteme);
 }
 
 
-Eigen::Matrix<double, 3, 1> Vinti::getPosition(const JulianDate& jd,
-                                               EphemFrame frame) const
+void Vinti::getStateVectors(const std::vector<JulianDate>& jd,
+                       EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkStateVectors(jd, xvec.cols(), "Vinti");
+
+  for (unsigned long ii=0UL; ii<jd.size(); ++ii) {
+    xvec.col(ii) = this->propagate(jd[ii]);
+  }
+
+  if (frame == EphemFrame::eci) {
+    m_ecfeci->teme2eci(jd, xvec, xvec);
+  } else {
+    m_ecfeci->teme2ecf(jd, xvec, xvec);
+  }
+}
+
+
+void Vinti::sample(const JulianDate& start, const Duration& dt,
+                       unsigned long n, EphemFrame frame,
+                       Eigen::Ref<Eigen::Matrix<double, 6, Eigen::Dynamic>> xvec)
+                                                                         const
+{
+  checkSample(n, xvec.cols(), "Vinti");
+
+  double dt_days {dt.getDays()};
+  EcfEciCursor f2i {m_ecfeci};
+  for (unsigned long ii=0UL; ii<n; ++ii) {
+    JulianDate jd {start + ii*dt_days};
+    xvec.col(ii) = this->propagate(jd);
+    EcfEciTransform f2i_now {f2i.getTransform(jd)};
+    if (frame == EphemFrame::eci) {
+      xvec.col(ii) = f2i_now.teme2eci(xvec.block<3,1>(0,ii),
+                                      xvec.block<3,1>(3,ii));
+    } else {
+      xvec.col(ii) = f2i_now.teme2ecf(xvec.block<3,1>(0,ii),
+                                      xvec.block<3,1>(3,ii));
+    }
+  }
+}
+
+
+Eigen::Matrix<double, 6, 1> Vinti::propagate(const JulianDate& jd) const
 {
   std::array<double, 6> oe;
   std::array<double, 6> x1;
   double t1 {cal_const::sec_per_day*(jd - m_jd0)};
   Vinti6(m_planet.data(), 0.0, m_x0.data(), t1, x1.data(), oe.data());
 
-  Eigen::Matrix<double, 3, 1> xteme;
+  Eigen::Matrix<double, 6, 1> xteme;
   xteme(0) = phy_const::du_per_km*x1[0];
   xteme(1) = phy_const::du_per_km*x1[1];
   xteme(2) = phy_const::du_per_km*x1[2];
-  Eigen::Matrix<double, 3, 1> xecf = m_ecfeci->teme2ecf(jd, xteme);
+  xteme(3) = phy_const::du_per_km*x1[3]*phy_const::sec_per_tu;
+  xteme(4) = phy_const::du_per_km*x1[4]*phy_const::sec_per_tu;
+  xteme(5) = phy_const::du_per_km*x1[5]*phy_const::sec_per_tu;
 
-  if (frame == EphemFrame::eci) {
-    return m_ecfeci->ecf2eci(jd, xecf);
-  }
-  return xecf;
+  return xteme;
 }
 
 
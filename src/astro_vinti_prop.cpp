@@ -72,6 +72,7 @@
 #include <cal_julian_date.h>
 #include <astro_ephemeris.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ecfeci_transform.h>
 
 namespace {
   constexpr double csq {phy_const::j2};
@@ -89,12 +90,9 @@ VintiProp::VintiProp(const std::string& orbit_name,
    jd0 = epoch;
    ecfeci = std::move(ecfeciSys);
      // A true equator ECI frame is required for propagation
-   Eigen::Matrix<double, 6, 1> xecf = ecfeci->eci2ecf(jd0,
-                                                      xeci.block<3,1>(0,0),
-                                                      xeci.block<3,1>(3,0));
-   Eigen::Matrix<double, 6, 1> xteme = ecfeci->ecf2teme(jd0,
-                                                        xecf.block<3,1>(0,0),
-                                                        xecf.block<3,1>(3,0));
+   Eigen::Matrix<double, 6, 1> xteme =
+       ecfeci->getTransform(jd0).eci2teme(xeci.block<3,1>(0,0),
+                                          xeci.block<3,1>(3,0));
    for (int ii=0; ii<3; ++ii) {
      pin[ii] = xteme(ii);
      vin[ii] = xteme(ii+3);
@@ -703,14 +701,12 @@ Eigen::Matrix<double, 6, 1> VintiProp::getStateVector(const JulianDate& jd,
   xteme(3) = x1[3];
   xteme(4) = x1[4];
   xteme(5) = x1[5];
-  Eigen::Matrix<double, 6, 1> xecf = ecfeci->teme2ecf(jd,
-                                                      xteme.block<3,1>(0,0),
-                                                      xteme.block<3,1>(3,0));
+  EcfEciTransform f2i {ecfeci->getTransform(jd)};
 
   if (frame == EphemFrame::eci) {
-    return ecfeci->ecf2eci(jd, xecf.block<3,1>(0,0), xecf.block<3,1>(3,0));
+    return f2i.teme2eci(xteme.block<3,1>(0,0), xteme.block<3,1>(3,0));
   }
-  return xecf;
+  return f2i.teme2ecf(xteme.block<3,1>(0,0), xteme.block<3,1>(3,0));
 }
 
 
@@ -21,6 +21,7 @@
 #include <cal_julian_date.h>
 #include <astro_ground_point.h>
 #include <astro_ephemeris.h>
+#include <astro_ephemeris_variant.h>
 #include <astro_keplerian.h>
 #include <axs_gp_constraints.h>
 
@@ -38,16 +39,17 @@ namespace {
 
 namespace eom {
 
-GpAccessStd::GpAccessStd(const JulianDate& jdStart,
-                         const JulianDate& jdStop,
-                         const GroundPoint& gp,
-                         const GpConstraints& xcs,
-                         std::shared_ptr<const Ephemeris> eph) :
-                             m_jdStart {jdStart},
-                             m_jdStop {jdStop},
-                             m_gp {gp},
-                             m_xcs {xcs},
-                             m_eph {std::move(eph)}
+template<typename E>
+GpAccessStd<E>::GpAccessStd(const JulianDate& jdStart,
+                            const JulianDate& jdStop,
+                            const GroundPoint& gp,
+                            const GpConstraints& xcs,
+                            std::shared_ptr<const E> eph) :
+                                m_jdStart {jdStart},
+                                m_jdStop {jdStop},
+                                m_gp {gp},
+                                m_xcs {xcs},
+                                m_eph {std::move(eph)}
 {
   m_jd = jdStart;
 
@@ -101,7 +103,8 @@ GpAccessStd::GpAccessStd(const JulianDate& jdStart,
 }
 
 
-bool GpAccessStd::findNextAccess()
+template<typename E>
+bool GpAccessStd<E>::findNextAccess()
 {
     // Don't search if current time is past stop time
   if (m_jdStop <= m_jd) {
@@ -131,7 +134,8 @@ bool GpAccessStd::findNextAccess()
 }
 
 
-bool GpAccessStd::findAllAccesses()
+template<typename E>
+bool GpAccessStd<E>::findAllAccesses()
 {
   bool found_interval {false};
 
@@ -147,19 +151,23 @@ bool GpAccessStd::findAllAccesses()
 }
 
 
-std::string GpAccessStd::getGpName() const
+template<typename E>
+std::string GpAccessStd<E>::getGpName() const
 {
   return m_gp.getName();
 }
 
 
-std::string GpAccessStd::getOrbitName() const
+template<typename E>
+std::string GpAccessStd<E>::getOrbitName() const
 {
   return (*m_eph).getName();
 }
 
 
-bool GpAccessStd::is_visible(const JulianDate& jd, double* new_dt_days) const
+template<typename E>
+bool GpAccessStd<E>::is_visible(const JulianDate& jd,
+                                double* new_dt_days) const
 {
     // Ensure ephemeris past availability is not requested
   if (m_jdStop < m_jd  ||  m_jd < m_jdStart) {
@@ -186,7 +194,8 @@ bool GpAccessStd::is_visible(const JulianDate& jd, double* new_dt_days) const
 }
 
 
-bool GpAccessStd::findRise(axs_interval& axs)
+template<typename E>
+bool GpAccessStd<E>::findRise(axs_interval& axs)
 {
   double dt_days {m_dt_days_p};
   bool found_rise {false};
@@ -225,7 +234,8 @@ bool GpAccessStd::findRise(axs_interval& axs)
 }
 
 
-void GpAccessStd::findSet(axs_interval& axs)
+template<typename E>
+void GpAccessStd<E>::findSet(axs_interval& axs)
 {
   double dt_days {m_dt_days_p};
   bool found_set {true};
@@ -260,7 +270,8 @@ void GpAccessStd::findSet(axs_interval& axs)
   }
 }
 
-void GpAccessStd::setRiseSetStatus(axs_interval& axs)
+template<typename E>
+void GpAccessStd<E>::setRiseSetStatus(axs_interval& axs)
 {
   axs.rasel_rise = m_gp.getRngAzSinEl(m_eph->getPosition(axs.rise,
                                                          EphemFrame::ecf));
@@ -268,4 +279,13 @@ void GpAccessStd::setRiseSetStatus(axs_interval& axs)
                                                         EphemFrame::ecf));
 }
 
+
+  // Type erased and EphemerisVariant instantiations
+template class GpAccessStd<Ephemeris>;
+template class GpAccessStd<SpEphemeris>;
+template class GpAccessStd<MappedEphemeris>;
+template class GpAccessStd<Sp3Hermite>;
+template class GpAccessStd<Sp3Chebyshev>;
+
+
 }
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2021, 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cal_leap_seconds.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <utl_hash.h>
+#include <cal_const.h>
+#include <cal_greg_date.h>
+#include <cal_julian_date.h>
+
+namespace eom {
+
+
+LeapSeconds::LeapSeconds(double tai_utc)
+{
+  m_mjd2000.push_back(0.0);
+  m_tai_utc.push_back(tai_utc);
+  this->setHash();
+}
+
+
+LeapSeconds::LeapSeconds(const std::string& fname)
+{
+  std::ifstream ifs(fname);
+  if (!ifs.is_open()) {
+    throw std::runtime_error("LeapSeconds::LeapSeconds() Can't open " + fname);
+  }
+
+  std::string input_line;
+  while (std::getline(ifs, input_line)) {
+    auto first = input_line.find_first_not_of(" \t\r");
+    if (first == std::string::npos  ||  input_line[first] == '#') {
+      continue;
+    }
+    std::istringstream iss(input_line);
+    double mjd;
+    int day, month, year;
+    double tai_utc;
+    if (!(iss >> mjd >> day >> month >> year >> tai_utc)) {
+      throw std::runtime_error("LeapSeconds::LeapSeconds() Bad record: " +
+                               input_line);
+    }
+    JulianDate jd(GregDate(year, month, day));
+    if (!m_mjd2000.empty()  &&  jd.getMjd2000() <= m_mjd2000.back()) {
+      throw std::runtime_error(
+          "LeapSeconds::LeapSeconds() Records out of order: " + input_line);
+    }
+    m_mjd2000.push_back(jd.getMjd2000());
+    m_tai_utc.push_back(tai_utc);
+  }
+  if (m_mjd2000.empty()) {
+    throw std::runtime_error("LeapSeconds::LeapSeconds() No records in " +
+                             fname);
+  }
+  this->setHash();
+}
+
+
+double LeapSeconds::getTai_Utc(const JulianDate& utc) const noexcept
+{
+  unsigned long last {m_last.load(std::memory_order_relaxed)};
+  unsigned long ndx {this->locate(utc.getMjd2000(), last)};
+  if (ndx != last) {
+    m_last.store(ndx, std::memory_order_relaxed);
+  }
+
+  return m_tai_utc[ndx];
+}
+
+
+double LeapSeconds::getTai_Utc(const JulianDate& utc,
+                               unsigned long& hint) const noexcept
+{
+  hint = this->locate(utc.getMjd2000(), hint);
+
+  return m_tai_utc[hint];
+}
+
+
+JulianDate LeapSeconds::tt2utc(const JulianDate& tt) const noexcept
+{
+  unsigned long hint {m_last.load(std::memory_order_relaxed)};
+  JulianDate utc {this->tt2utc(tt, hint)};
+  m_last.store(hint, std::memory_order_relaxed);
+
+  return utc;
+}
+
+
+JulianDate LeapSeconds::tt2utc(const JulianDate& tt,
+                               unsigned long& hint) const noexcept
+{
+    // TAI - UTC is a function of UTC - approximate UTC with TT, then
+    // refine once
+  double dtt {this->getTai_Utc(tt, hint) + cal_const::ttmtai};
+  JulianDate utc {tt + -1.0*dtt*cal_const::day_per_sec};
+  dtt = this->getTai_Utc(utc, hint) + cal_const::ttmtai;
+
+  return tt + -1.0*dtt*cal_const::day_per_sec;
+}
+
+
+unsigned long LeapSeconds::locate(double mjd2000,
+                                  unsigned long hint) const noexcept
+{
+  unsigned long nrec {static_cast<unsigned long>(m_mjd2000.size())};
+  if (hint < nrec  &&  m_mjd2000[hint] <= mjd2000  &&
+      (hint + 1UL == nrec  ||  mjd2000 < m_mjd2000[hint + 1UL])) {
+    return hint;
+  }
+    // Times before the first record use the first record
+  auto it = std::upper_bound(m_mjd2000.begin(), m_mjd2000.end(), mjd2000);
+  if (it == m_mjd2000.begin()) {
+    return 0UL;
+  }
+
+  return static_cast<unsigned long>(it - m_mjd2000.begin()) - 1UL;
+}
+
+
+void LeapSeconds::setHash() noexcept
+{
+  m_hash = fnv1a::offset;
+  fnv1a::hash(m_hash, m_mjd2000.data(), m_mjd2000.size()*sizeof(double));
+  fnv1a::hash(m_hash, m_tai_utc.data(), m_tai_utc.size()*sizeof(double));
+}
+
+
+}
@@ -16,6 +16,7 @@
 
 #include <eom_config.h>
 #include <eom_ephem_printer.h>
+#include <eom_ephem_writer.h>
 #include <eom_orbit_printer.h>
 #include <eom_range_printer.h>
 #include <eom_rtc_printer.h>
@@ -52,6 +53,10 @@ std::unique_ptr<EomCommand> buildCommand(std::deque<std::string>& tokens,
     std::unique_ptr<EomCommand> command =
         std::make_unique<EomRtcPrinter>(tokens, cfg);
     return command;
+  } else if (command_str == "WriteEphemeris") {
+    std::unique_ptr<EomCommand> command =
+        std::make_unique<EomEphemWriter>(tokens, cfg);
+    return command;
   } else {
     throw std::invalid_argument(
         "EomCommandBuilder::buildCommand Invalid command type: " + command_str);
@@ -8,7 +8,11 @@
 
 #include <eom_config.h>
 
+#include <cstddef>
 #include <deque>
+#include <exception>
+#include <map>
+#include <memory>
 #include <ostream>
 #include <set>
 #include <stdexcept>
@@ -72,15 +76,25 @@ void EomConfig::setLeapSeconds(std::deque<std::string>& tokens)
     error_string = "Invalid number of parameters EomConfig::setLeapSeconds";
     return;
   }
+    // Either a fixed number of leap seconds, or an IERS leap second file
   try {
-    auto seconds = std::stod(tokens[0]);
+    std::size_t nchar {0};
+    double seconds {0.0};
+    try {
+      seconds = std::stod(tokens[0], &nchar);
+    } catch (const std::invalid_argument& ia) {
+      nchar = 0;
+    }
+    if (nchar > 0  &&  nchar == tokens[0].size()) {
+      m_leap_seconds = std::make_shared<const eom::LeapSeconds>(seconds);
+    } else {
+      m_leap_seconds = std::make_shared<const eom::LeapSeconds>(tokens[0]);
+    }
     tokens.pop_front();
-    eom::LeapSeconds& ls = eom::LeapSeconds::getInstance();
-    ls.setTai_Utc(seconds);
     valid = true;
     leapsec_set = true;
-  } catch (const std::invalid_argument& ia) {
-    error_string = ia.what();
+  } catch (const std::exception& e) {
+    error_string = e.what();
     error_string += " EomConfig::setLeapSeconds";
   }
 }
@@ -89,12 +103,24 @@ void EomConfig::setLeapSeconds(std::deque<std::string>& tokens)
 void EomConfig::setEcfEciRate(std::deque<std::string>& tokens)
 {
   valid = false;
-  if (tokens.size() != 2) {
+  if (tokens.size() < 2  ||  tokens.size() > 4) {
     error_string = "Invalid number of parameters EomConfig::setEcfEciRate";
     return;
   }
   try {
     dtEcfEci = parse_duration(tokens);
+    while (!tokens.empty()) {
+      if (tokens[0] == "Lazy") {
+        f2i_lazy = true;
+      } else if (tokens[0] == "Chebyshev") {
+        f2i_chebyshev = true;
+      } else {
+        error_string = "Invalid EcfEciRate option " + tokens[0] +
+                       "  EomConfig::setEcfEciRate";
+        return;
+      }
+      tokens.pop_front();
+    }
     valid = true;
     f2i_rate_set = true;
   } catch (const std::invalid_argument& ia) {
@@ -104,6 +130,19 @@ void EomConfig::setEcfEciRate(std::deque<std::string>& tokens)
 }
 
 
+void EomConfig::setEcfEciCache(std::deque<std::string>& tokens)
+{
+  valid = false;
+  if (tokens.size() != 1) {
+    error_string = "Invalid number of parameters EomConfig::setEcfEciCache";
+    return;
+  }
+  f2i_cache_dir = tokens[0];
+  tokens.pop_front();
+  valid = true;
+}
+
+
 void EomConfig::setIoPerRad(std::deque<std::string>& tokens)
 {
   using namespace std::string_literals;
@@ -181,6 +220,43 @@ void EomConfig::setOutputRate(std::deque<std::string>& tokens)
 }
 
 
+void EomConfig::addEphemerisCache(std::deque<std::string>& tokens)
+{
+  valid = false;
+  if (tokens.size() != 1  &&  tokens.size() != 3) {
+    error_string =
+        "Invalid number of parameters EomConfig::addEphemerisCache";
+    return;
+  }
+  auto name = tokens[0];
+  tokens.pop_front();
+  unsigned long slots {4096UL};
+  if (tokens.size() == 2) {
+    if (tokens[0] != "Slots") {
+      error_string = "Invalid EphemerisCache option " + tokens[0] +
+                     "  EomConfig::addEphemerisCache";
+      return;
+    }
+    tokens.pop_front();
+    try {
+      slots = std::stoul(tokens[0]);
+    } catch (const std::exception& e) {
+      error_string = "Invalid EphemerisCache Slots " + tokens[0] +
+                     "  EomConfig::addEphemerisCache";
+      return;
+    }
+    tokens.pop_front();
+    if (slots == 0UL) {
+      error_string = "EphemerisCache Slots must be positive"
+                     "  EomConfig::addEphemerisCache";
+      return;
+    }
+  }
+  m_eph_caches[name] = slots;
+  valid = true;
+}
+
+
 void EomConfig::addPendingOrbit(const std::string& orbit_name)
 {
   m_orbit_names.insert(orbit_name);
@@ -200,7 +276,6 @@ std::vector<std::string>EomConfig::getCelestials() const
 
 std::ostream& operator<<(std::ostream& out, const EomConfig& cfg)
 {
-  eom::LeapSeconds& ls = eom::LeapSeconds::getInstance();
   return out << "\nSimulation Start Time: " <<
                 cfg.getStartTime().to_str() <<
                 "\nSimulation Stop Time:  " <<
@@ -208,7 +283,10 @@ std::ostream& operator<<(std::ostream& out, const EomConfig& cfg)
                 "\nEcfEci Output Rate is " << 
                 cal_const::min_per_day*cfg.getEcfEciRate().getDays() <<
                 " minutes" <<
-                "\nLeap Seconds (TAI - UTC): " << ls.getTai_Utc() <<
+                (cfg.getEcfEciLazy() ? " (lazy)" : "") <<
+                (cfg.getEcfEciChebyshev() ? " (Chebyshev)" : "") <<
+                "\nLeap Seconds (TAI - UTC): " <<
+                cfg.getLeapSeconds()->getTai_Utc(cfg.getStartTime()) <<
                 "\nUsing dt eps: " <<
                 phy_const::epsdt*phy_const::sec_per_tu << " seconds" <<
                 "\nOne ER is " <<
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <eom_ephem_writer.h>
+
+#include <memory>
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <stdexcept>
+
+#include <astro_ephemeris.h>
+#include <astro_cached_ephemeris.h>
+#include <astro_sp_ephemeris.h>
+
+#include <eom_command.h>
+#include <eom_config.h>
+
+namespace eom_app {
+
+
+EomEphemWriter::EomEphemWriter(std::deque<std::string>& tokens,
+                               const EomConfig& cfg)
+{
+  using namespace std::string_literals;
+  if (tokens.size() != 2) {
+    throw std::invalid_argument("EomEphemWriter::EomEphemWriter() "s +
+                                "WriteEphemeris requires 2 arguments " +
+                                "vs. input " +
+                                std::to_string(tokens.size()));
+  }
+  m_orbit_name = tokens[0];
+  tokens.pop_front();
+  if (!cfg.pendingOrbit(m_orbit_name)) {
+    throw std::invalid_argument("EomEphemWriter::EomEphemWriter() "s +
+                                "Invalid orbit name " + m_orbit_name);
+  }
+  m_file_name = tokens[0];
+  tokens.pop_front();
+}
+
+
+void EomEphemWriter::validate(const std::unordered_map<
+    std::string, std::shared_ptr<eom::Ephemeris>>& ephemerides)
+{
+  using namespace std::string_literals;
+  std::shared_ptr<eom::Ephemeris> eph {nullptr};
+  try {
+    eph = ephemerides.at(m_orbit_name);
+  } catch (const std::out_of_range& oor) {
+    throw CmdValidateException("EomEphemWriter::validate() "s +
+                               "Invalid orbit name in WriteEphemeris: " +
+                               m_orbit_name);
+  }
+  auto cached = std::dynamic_pointer_cast<eom::CachedEphemeris>(eph);
+  if (cached != nullptr) {
+    eph = cached->getEphemeris();
+  }
+  m_eph = std::dynamic_pointer_cast<eom::SpEphemeris>(eph);
+  if (m_eph == nullptr) {
+    throw CmdValidateException("EomEphemWriter::validate() "s +
+                               "WriteEphemeris requires an SP orbit: " +
+                               m_orbit_name);
+  }
+}
+
+
+void EomEphemWriter::execute() const
+{
+  m_eph->write(m_file_name);
+}
+
+
+}
@@ -103,6 +103,9 @@ void EomOrbitPrinter::execute() const
     fout << '\n';
 
       // Create time and range data
+    Eigen::Matrix<double, 6, Eigen::Dynamic> pv(6, nrec);
+    m_eph->sample(m_jdStart, m_dtOut, nrec, m_frame, pv);
+
     fout << "\ntpv = [";
     fout << std::scientific;
     fout.precision(16);
@@ -112,11 +115,8 @@ void EomOrbitPrinter::execute() const
       }
       double dtnow {ii*dt};
       fout << "\n  " << dtnow << " ";
-      eom::JulianDate jdNow {m_jdStart + phy_const::day_per_tu*dtnow};
-      Eigen::Matrix<double, 6, 1> pv =
-          m_eph->getStateVector(jdNow, m_frame);
       for (int jj=0; jj<6; ++jj) {
-        fout << " " << pv(jj);
+        fout << " " << pv(jj,ii);
       }
     }
 
@@ -114,6 +114,11 @@ void EomRangePrinter::execute() const
     fout << '\n';
 
       // Create time and range data
+    Eigen::Matrix<double, 6, Eigen::Dynamic> pv1(6, nrec);
+    Eigen::Matrix<double, 6, Eigen::Dynamic> pv2(6, nrec);
+    m_eph[0]->sample(m_jdStart, m_dtOut, nrec, eom::EphemFrame::eci, pv1);
+    m_eph[1]->sample(m_jdStart, m_dtOut, nrec, eom::EphemFrame::eci, pv2);
+
     fout << "\ntime_range = [";
     fout << std::scientific;
     fout.precision(16);
@@ -123,13 +128,8 @@ void EomRangePrinter::execute() const
       }
       double dtnow {ii*dt};
       fout << "\n  " << dtnow << " ";
-      eom::JulianDate jdNow {m_jdStart +
-                             phy_const::day_per_tu*(dtnow/m_to_time_units)};
-      Eigen::Matrix<double, 3, 1> r1 =
-          m_eph[0]->getPosition(jdNow, eom::EphemFrame::eci);
-      Eigen::Matrix<double, 3, 1> r2 =
-          m_eph[1]->getPosition(jdNow, eom::EphemFrame::eci);
-      Eigen::Matrix<double, 3, 1> dr = r1 - r2;
+      Eigen::Matrix<double, 3, 1> dr = pv1.block<3,1>(0,ii) -
+                                       pv2.block<3,1>(0,ii);
       double range = dr.norm();
       fout << " " << m_to_distance_units*range;
     }
@@ -100,6 +100,11 @@ void EomRtcPrinter::execute() const
     fout << '\n';
 
       // Create time and range data
+    Eigen::Matrix<double, 6, Eigen::Dynamic> pv1(6, nrec);
+    Eigen::Matrix<double, 6, Eigen::Dynamic> pv2(6, nrec);
+    m_eph[0]->sample(m_jdStart, m_dtOut, nrec, eom::EphemFrame::eci, pv1);
+    m_eph[1]->sample(m_jdStart, m_dtOut, nrec, eom::EphemFrame::eci, pv2);
+
     fout << "\ntime_rtc = [";
     fout << std::scientific;
     fout.precision(16);
@@ -109,15 +114,10 @@ void EomRtcPrinter::execute() const
       }
       double dtnow {ii*dt};
       fout << "\n  " << dtnow << " ";
-      eom::JulianDate jdNow {m_jdStart +
-                             phy_const::day_per_tu*(dtnow/m_to_time_units)};
-      Eigen::Matrix<double, 6, 1> pv1 =
-          m_eph[0]->getStateVector(jdNow, eom::EphemFrame::eci);
-      Eigen::Matrix<double, 3, 1> r1 {pv1.block<3,1>(0,0)};
-      Eigen::Matrix<double, 3, 1> r2 =
-          m_eph[1]->getPosition(jdNow, eom::EphemFrame::eci);
+      Eigen::Matrix<double, 3, 1> r1 {pv1.block<3,1>(0,ii)};
+      Eigen::Matrix<double, 3, 1> r2 {pv2.block<3,1>(0,ii)};
       Eigen::Matrix<double, 3, 1> dr = r1 - r2;
-      Eigen::Matrix<double, 3, 1> v1 {pv1.block<3,1>(3,0)};
+      Eigen::Matrix<double, 3, 1> v1 {pv1.block<3,1>(3,ii)};
       Eigen::Matrix<double, 3, 3> i2rtcDcm {eom::AttitudeRtc<double>(r1, v1)};
       dr = i2rtcDcm*dr;
       for (int jj=0; jj<3; ++jj) {
@@ -28,6 +28,30 @@ void eom_test(std::deque<std::string>& tokens)
     eom_test_sun();
   } else if (test_str == "MoonEph") {
     eom_test_moon();
+  } else if (test_str == "Hermite2Table") {
+    eom_test_hermite2_table();
+  } else if (test_str == "Hermite2TableCompact") {
+    eom_test_hermite2_table_compact();
+  } else if (test_str == "EphemerisBinary") {
+    eom_test_ephemeris_binary();
+  } else if (test_str == "EphemerisCache") {
+    eom_test_ephemeris_cache();
+  } else if (test_str == "SpLazy") {
+    eom_test_sp_lazy();
+  } else if (test_str == "RKF78") {
+    eom_test_rkf78();
+  } else if (test_str == "AdamsVSVO") {
+    eom_test_adams();
+  } else if (test_str == "GJ8") {
+    eom_test_gj8();
+  } else if (test_str == "Ensemble") {
+    eom_test_ensemble();
+  } else if (test_str == "Dispersion") {
+    eom_test_dispersion();
+  } else if (test_str == "EcfEciChebyshev") {
+    eom_test_ecfeci_chebyshev();
+  } else if (test_str == "EcfEciRegistry") {
+    eom_test_ecfeci_registry();
   } else {
     throw std::invalid_argument("eom_test Invalid test type: " + test_str);
   }
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_build.h>
+#include <astro_dispersion_def.h>
+#include <astro_dispersion_stats.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_orbit_def.h>
+#include <astro_propagator_config.h>
+
+#include <eom_test.h>
+
+namespace {
+  constexpr unsigned long ntraj {500UL};
+  constexpr unsigned long npoints {20UL};
+}
+
+namespace eom_app {
+
+void eom_test_dispersion()
+{
+  std::cout << "\n\n  === Test:  Dispersion ===";
+
+  eom::JulianDate jdEpoch(2460000.5);
+  eom::Duration dt(10.0, phy_const::tu_per_min);
+
+    // Running statistics vs. two pass mean and covariance of random
+    // trajectories with a large mean relative to their spread
+  std::mt19937_64 gen(12345UL);
+  std::normal_distribution<double> unit_normal;
+  std::vector<Eigen::Matrix<double, 6, Eigen::Dynamic>> trajs(ntraj);
+  eom::DispersionStats stats("stats", jdEpoch, dt, npoints);
+  for (auto& xvec : trajs) {
+    xvec.resize(6, npoints);
+    for (unsigned long jj=0; jj<npoints; ++jj) {
+      for (int ii=0; ii<6; ++ii) {
+        xvec(ii, jj) = 1.0 + 0.1*ii + 1.0e-4*(jj + 1)*unit_normal(gen);
+      }
+    }
+    stats.accumulate(xvec);
+  }
+  double max_mean_diff {0.0};
+  double max_cov_diff {0.0};
+  for (unsigned long jj=0; jj<npoints; ++jj) {
+    Eigen::Matrix<double, 6, 1> mean = Eigen::Matrix<double, 6, 1>::Zero();
+    for (const auto& xvec : trajs) {
+      mean += xvec.col(jj);
+    }
+    mean /= ntraj;
+    Eigen::Matrix<double, 6, 6> cov = Eigen::Matrix<double, 6, 6>::Zero();
+    for (const auto& xvec : trajs) {
+      Eigen::Matrix<double, 6, 1> dx = xvec.col(jj) - mean;
+      cov += dx*dx.transpose();
+    }
+    cov /= (ntraj - 1UL);
+    max_mean_diff = std::max(max_mean_diff,
+                             (stats.getMean(jj) - mean).cwiseAbs().maxCoeff());
+    max_cov_diff = std::max(max_cov_diff,
+                            (stats.getCovariance(jj) - cov).norm()/cov.norm());
+  }
+  std::cout << "\n  Max mean difference vs. two pass:                " <<
+               max_mean_diff;
+  std::cout << "\n  Max relative covariance difference vs. two pass: " <<
+               max_cov_diff;
+  bool pass {stats.getSamples() == ntraj  &&
+             max_mean_diff < 1.0e-13  &&  max_cov_diff < 1.0e-10};
+
+    // Sampled states at epoch should reproduce the input covariance to
+    // within sampling error, about sqrt(2/n)
+  Eigen::Matrix<double, 6, 6> sqrt_cov;
+  sqrt_cov << 1.0,  0.0,  0.0,  0.0,  0.0,  0.0,
+              0.5,  1.0,  0.0,  0.0,  0.0,  0.0,
+              0.2, -0.3,  1.0,  0.0,  0.0,  0.0,
+              0.0,  0.0,  0.0,  0.1,  0.0,  0.0,
+              0.0,  0.0,  0.0,  0.02, 0.1,  0.0,
+              0.0,  0.0,  0.0,  0.0,  0.05, 0.1;
+  sqrt_cov *= 1.0e-5;
+  Eigen::Matrix<double, 6, 6> cov = sqrt_cov*sqrt_cov.transpose();
+  eom::DispersionDef dispDef("disp", "template", 4000UL, 7UL, cov, "");
+  std::array<double, 6> oe {1.2, 0.05, 0.9, 0.3, 1.1, 0.2};
+  eom::OrbitDef templateOrbit("template",
+                              eom::PropagatorConfig(
+                                  eom::PropagatorType::kepler1),
+                              jdEpoch, oe,
+                              eom::CoordType::keplerian,
+                              eom::FrameType::gcrf);
+  auto ecfeci = std::make_shared<const eom::EcfEciSys>(
+      jdEpoch + -1.0, jdEpoch + 1.0, dt, nullptr,
+      std::make_shared<const eom::LeapSeconds>(37.0));
+  std::unordered_map<std::string, std::vector<eom::state_vector_rec>> ceph;
+  eom::DispersionStats sampled = eom::build_dispersion(dispDef,
+                                                       templateOrbit,
+                                                       jdEpoch, dt, 1UL,
+                                                       ecfeci, ceph);
+  double sample_err {(sampled.getCovariance(0) - cov).norm()/cov.norm()};
+  std::cout << "\n  Relative error of sampled covariance at epoch:   " <<
+               sample_err;
+  pass = pass  &&  sampled.getSamples() == 4000UL  &&  sample_err < 0.1;
+
+    // Covariances that are not positive semidefinite are rejected
+  Eigen::Matrix<double, 6, 6> bad_cov {cov};
+  bad_cov(0, 0) = -bad_cov(0, 0);
+  bool rejected {false};
+  try {
+    eom::DispersionDef bad("bad", "template", 10UL, 7UL, bad_cov, "");
+  } catch (const std::invalid_argument& ia) {
+    rejected = true;
+  }
+  std::cout << "\n  Indefinite covariance rejected: " <<
+               (rejected ? "yes" : "no");
+  pass = pass  &&  rejected;
+
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  Dispersion ===\n\n";
+}
+
+
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <Eigen/Dense>
+
+#include <utl_const.h>
+#include <phy_const.h>
+#include <cal_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_eop_sys.h>
+#include <astro_ecfeci_sys.h>
+
+#include <eom_test.h>
+
+namespace {
+  const std::string eop_file {"eom_test_ecfeci_chebyshev_eop.csv"};
+  const std::string leap_file {"eom_test_ecfeci_chebyshev_leap.dat"};
+
+    // EOP records span the 2017/01/01 leap second.  UT1 - TAI, seconds,
+    // drifts with a 27.55 day tidal term, and polar motion, arcsec,
+    // follows the Chandler wobble, so the fit sees curvature vs. data
+    // a cubic would reproduce exactly.  Daily values are interpolated
+    // linearly by EopSys, and the change in slope at each day boundary
+    // dominates the fit error.
+  constexpr long mjd_first {57745L};
+  constexpr long mjd_last {57765L};
+  constexpr long mjd_leap {57754L};
+  constexpr double ut1mtai0 {-36.4};
+  constexpr double ut1mtai_rate {-0.0015};
+  constexpr double ut1_amp {1.0e-4};
+  constexpr double ut1_rate {utl_const::tpi/27.55};
+  constexpr double pm_amp {0.15};
+  constexpr double pm_rate {utl_const::tpi/433.0};
+
+  double ut1mtai(double day)
+  {
+    return ut1mtai0 + ut1mtai_rate*day + ut1_amp*std::sin(ut1_rate*day);
+  }
+
+  void write_files()
+  {
+    std::ofstream fleap(leap_file);
+    fleap << "# MJD  Day  Month  Year  TAI-UTC\n" <<
+             "57204.0  1  7  2015  36\n" <<
+             "57754.0  1  1  2017  37\n";
+
+    std::ofstream feop(eop_file);
+    feop << "MJD;Year;Month;Day;Type;x_pole;sigma_x_pole;y_pole;" <<
+            "sigma_y_pole;Type;UT1-UTC;sigma_UT1-UTC;LOD;sigma_LOD;Type;" <<
+            "dPsi;sigma_dPsi;dEpsilon;sigma_dEpsilon;" <<
+            "dX;sigma_dX;dY;sigma_dY\n";
+    feop.precision(12);
+    for (long mjd=mjd_first; mjd<=mjd_last; ++mjd) {
+      double tai_utc {(mjd < mjd_leap) ? 36.0 : 37.0};
+      double day {static_cast<double>(mjd - mjd_first)};
+      double lod {-1000.0*(ut1mtai_rate +
+                           ut1_amp*ut1_rate*std::cos(ut1_rate*day))};
+      feop << mjd << ";2017;01;01;I;" <<
+              0.1 + pm_amp*std::cos(pm_rate*day) << ";0.0001;" <<
+              0.3 + pm_amp*std::sin(pm_rate*day) << ";0.0001;I;" <<
+              ut1mtai(day) + tai_utc << ";0.00001;" <<
+              lod << ";0.0001;I;" <<
+              "0.0;0.1;0.0;0.1;0.0;0.1;0.0;0.1\n";
+    }
+  }
+}
+
+namespace eom_app {
+
+void eom_test_ecfeci_chebyshev()
+{
+  std::cout << "\n\n  === Test:  EcfEciChebyshev ===";
+
+  write_files();
+  auto leapSeconds = std::make_shared<const eom::LeapSeconds>(leap_file);
+  auto eopSys = std::make_shared<eom::EopSys>(
+      eop_file, eom::JulianDate(cal_const::mjd + mjd_first + 1.0),
+      eom::JulianDate(cal_const::mjd + mjd_last - 1.0));
+
+    // Chebyshev interpolation at 240 minutes vs. linear interpolation at
+    // one minute over three days, ending before the leap second, and
+    // vs. direct evaluation of the reduction parameters at times between
+    // nodes.  Rotation errors are scaled to the Molniya apogee distance.
+  eom::JulianDate jdStart(cal_const::mjd + mjd_leap - 3.5);
+  eom::JulianDate jdStop {jdStart + 3.0};
+  eom::EcfEciSys ref(jdStart, jdStop,
+                     eom::Duration(1.0, phy_const::tu_per_min),
+                     eopSys, leapSeconds, true, false, false);
+  eom::EcfEciSys cheb(jdStart, jdStop,
+                      eom::Duration(240.0, phy_const::tu_per_min),
+                      eopSys, leapSeconds, true, false, true);
+  constexpr double r_apogee {7.3};
+  double max_err {0.0};
+  double max_direct {0.0};
+  int nsample {0};
+  for (double dt=0.0; dt<=3.0; dt+=7.0/1440.0) {
+    eom::JulianDate jd {jdStart + dt};
+      // A zero rate generates a single node at the requested time
+    bool direct {nsample++%10 == 0};
+    std::unique_ptr<eom::EcfEciSys> f2iDirect {nullptr};
+    if (direct) {
+      f2iDirect = std::make_unique<eom::EcfEciSys>(
+          jd, jd, eom::Duration(0.0, phy_const::tu_per_min),
+          eopSys, leapSeconds, false);
+    }
+    for (int ii=0; ii<3; ++ii) {
+      Eigen::Matrix<double, 3, 1> posf = Eigen::Matrix<double, 3, 1>::Zero();
+      posf(ii) = r_apogee;
+      Eigen::Matrix<double, 3, 1> posi {cheb.ecf2eci(jd, posf)};
+      Eigen::Matrix<double, 3, 1> dx = posi - ref.ecf2eci(jd, posf);
+      max_err = std::max(max_err, phy_const::m_per_du*dx.norm());
+      if (direct) {
+        dx = posi - f2iDirect->ecf2eci(jd, posf);
+        max_direct = std::max(max_direct, phy_const::m_per_du*dx.norm());
+      }
+    }
+  }
+  std::cout << "\n  Max position difference, 240 minute rate, m: " <<
+               max_err <<
+               "\n  Max position difference from direct evaluation, m: " <<
+               max_direct;
+  bool pass {max_err < 1.0e-3  &&  max_direct < 1.0e-3};
+
+    // UT1 - UTC fit across the leap second vs. the EOP source
+  jdStart = eom::JulianDate(cal_const::mjd + mjd_leap - 1.0);
+  jdStop = jdStart + 2.0;
+  eom::EcfEciSys leap(jdStart, jdStop,
+                      eom::Duration(240.0, phy_const::tu_per_min),
+                      eopSys, leapSeconds, true, false, true);
+  double max_dut1 {0.0};
+  for (double dt=0.0; dt<=2.0; dt+=7.0/1440.0) {
+    eom::JulianDate jd {jdStart + dt};
+    double ut1mutc {phy_const::sec_per_tu*leap.getEcfEciData(jd).ut1mutc};
+    double dut1 {ut1mutc - eopSys->getEop(jd).ut1mutc};
+    max_dut1 = std::max(max_dut1, std::abs(dut1));
+  }
+  std::cout << "\n  Max UT1 - UTC difference across leap second, sec: " <<
+               max_dut1;
+  pass = pass  &&  max_dut1 < 5.0e-7;
+
+  std::remove(eop_file.c_str());
+  std::remove(leap_file.c_str());
+
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  EcfEciChebyshev ===\n\n";
+}
+
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <memory>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_ecfeci_registry.h>
+#include <astro_ecfeci_sys.h>
+
+#include <eom_test.h>
+
+namespace eom_app {
+
+void eom_test_ecfeci_registry()
+{
+  std::cout << "\n\n  === Test:  EcfEciRegistry ===";
+
+  eom::JulianDate jd0(2460000.5);
+  eom::Duration dt(10.0, phy_const::tu_per_min);
+  auto leapSeconds = std::make_shared<const eom::LeapSeconds>(37.0);
+  eom::EcfEciRegistry registry;
+
+    // Sequential overlapping scenarios, each releasing its service
+    // before the next starts.  Unused services must not widen new ones.
+  double max_span {0.0};
+  unsigned long max_size {0};
+  for (int ii=0; ii<6; ++ii) {
+    auto f2iSys = registry.getEcfEciSys(jd0 + 1.0*ii, jd0 + (1.0*ii + 1.1),
+                                        dt, leapSeconds);
+    max_span = std::max(max_span,
+                        f2iSys->getEndTime() - f2iSys->getBeginTime());
+    max_size = std::max(max_size, registry.size());
+  }
+  std::cout << "\n  Sliding window max span, days: " << max_span <<
+               "  max services: " << max_size;
+  bool pass {max_span < 1.5  &&  max_size == 1};
+
+    // Overlapping services still held are merged into the new service,
+    // and requests within it share it
+  auto f2iA = registry.getEcfEciSys(jd0 + 10.0, jd0 + 11.0, dt, leapSeconds);
+  auto f2iB = registry.getEcfEciSys(jd0 + 10.9, jd0 + 12.0, dt, leapSeconds);
+  auto f2iC = registry.getEcfEciSys(jd0 + 10.2, jd0 + 11.5, dt, leapSeconds);
+  bool merged {!(jd0 + 10.0 < f2iB->getBeginTime())  &&
+               !(f2iB->getEndTime() < jd0 + 12.0)  &&
+               f2iB == f2iC  &&  registry.size() == 1};
+  std::cout << "\n  Held overlap merged and shared: " << merged;
+  pass = pass  &&  merged;
+
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  EcfEciRegistry ===\n\n";
+}
+
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_build.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ephemeris.h>
+#include <astro_orbit_def.h>
+#include <astro_propagator_config.h>
+
+#include <eom_test.h>
+
+namespace eom_app {
+
+void eom_test_ensemble()
+{
+  std::cout << "\n\n  === Test:  Ensemble ===";
+
+  eom::JulianDate jdEpoch(2460000.5);
+  eom::JulianDate jdStart {jdEpoch + -0.25};
+  eom::JulianDate jdStop {jdEpoch + 1.0};
+    // Integration extends slightly past the ephemeris limits
+  auto ecfeci = std::make_shared<const eom::EcfEciSys>(
+      jdStart + -1.0, jdStop + 1.0,
+      eom::Duration(10.0, phy_const::tu_per_min), nullptr,
+      std::make_shared<const eom::LeapSeconds>(37.0));
+  std::unordered_map<std::string, std::vector<eom::state_vector_rec>> ceph;
+
+    // Members share all ensemble relevant settings
+  eom::PropagatorConfig pCfg(eom::PropagatorType::sp);
+  pCfg.setStartStopTime(jdStart, jdStop);
+  pCfg.setStepSize(eom::Duration(1.0, phy_const::tu_per_min));
+  pCfg.setGravityModel(eom::GravityModel::std);
+  pCfg.setDegreeOrder(8, 8);
+  pCfg.setSunGravityModel(eom::SunGravityModel::meeus);
+  pCfg.setMoonGravityModel(eom::MoonGravityModel::meeus);
+  pCfg.enableEnsemble();
+  std::vector<eom::OrbitDef> orbitDefs;
+  for (int ii=0; ii<5; ++ii) {
+    std::array<double, 6> oe {1.1 + 0.1*ii, 0.01 + 0.02*ii, 0.5 + 0.2*ii,
+                              0.3*ii, 1.1, 0.4*ii};
+    orbitDefs.emplace_back("member" + std::to_string(ii), pCfg, jdEpoch, oe,
+                           eom::CoordType::keplerian, eom::FrameType::gcrf);
+  }
+  auto ensemble = eom::build_orbits(orbitDefs, ecfeci, ceph);
+
+    // Each member propagated on its own should reproduce the ensemble
+    // other than rounding in force model evaluation
+  double max_diff {0.0};
+  for (unsigned long ii=0; ii<orbitDefs.size(); ++ii) {
+    auto single = eom::build_orbit(orbitDefs[ii], ecfeci, ceph);
+    for (double dt=0.0; dt<=1.25; dt+=0.005) {
+      eom::JulianDate jd {jdStart + dt};
+      Eigen::Matrix<double, 3, 1> dr =
+          ensemble[ii]->getPosition(jd, eom::EphemFrame::eci) -
+          single->getPosition(jd, eom::EphemFrame::eci);
+      max_diff = std::max(max_diff, dr.norm());
+    }
+  }
+  max_diff *= phy_const::m_per_du;
+  std::cout << "\n  Max position difference vs. individual, m: " << max_diff;
+  std::cout << "\n  " << ((max_diff < 1.0e-6) ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  Ensemble ===\n\n";
+}
+
+
+}
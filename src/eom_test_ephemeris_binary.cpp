@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_build.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ephemeris.h>
+#include <astro_ephemeris_binary.h>
+#include <astro_mapped_ephemeris.h>
+#include <astro_orbit_def.h>
+#include <astro_propagator_config.h>
+#include <astro_sp_ephemeris.h>
+
+#include <eom_test.h>
+
+namespace {
+  const std::string eph_file {"eom_test_ephemeris_binary.eomb"};
+  const std::string bad_file {"eom_test_ephemeris_binary_bad.eomb"};
+
+  std::vector<char> read_file(const std::string& fname)
+  {
+    std::ifstream fin(fname, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(fin),
+                             std::istreambuf_iterator<char>());
+  }
+
+  void write_file(const std::string& fname, const std::vector<char>& bytes)
+  {
+    std::ofstream fout(fname, std::ios::binary);
+    fout.write(bytes.data(), bytes.size());
+  }
+
+    // Overwrite a header field with a value of the same size
+  template<typename T>
+  std::vector<char> set_field(std::vector<char> bytes, std::size_t offset,
+                              T value)
+  {
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+    return bytes;
+  }
+
+    // True if mapping the file is rejected with a runtime_error
+  bool rejected(const std::vector<char>& bytes,
+                const std::shared_ptr<const eom::EcfEciSys>& ecfeci)
+  {
+    write_file(bad_file, bytes);
+    bool threw {false};
+    try {
+      eom::MappedEphemeris bad("bad", bad_file, ecfeci);
+    } catch (const std::runtime_error& re) {
+      threw = true;
+    }
+    std::remove(bad_file.c_str());
+    return threw;
+  }
+}
+
+namespace eom_app {
+
+void eom_test_ephemeris_binary()
+{
+  std::cout << "\n\n  === Test:  EphemerisBinary ===";
+
+  eom::JulianDate jdEpoch(2460000.5);
+  eom::JulianDate jdStart {jdEpoch + -0.25};
+  eom::JulianDate jdStop {jdEpoch + 1.0};
+    // Integration extends slightly past the ephemeris limits
+  auto ecfeci = std::make_shared<const eom::EcfEciSys>(
+      jdStart + -1.0, jdStop + 1.0, eom::Duration(1.0, phy_const::tu_per_min),
+      nullptr, std::make_shared<const eom::LeapSeconds>(37.0));
+  std::unordered_map<std::string, std::vector<eom::state_vector_rec>> ceph;
+  std::array<double, 6> oe {1.2, 0.05, 0.9, 0.3, 1.1, 0.2};
+
+    // Full precision, compact, and compact with ECF interpolators
+  bool pass {true};
+  for (int icfg=0; icfg<3; ++icfg) {
+    eom::PropagatorConfig pCfg(eom::PropagatorType::sp);
+    pCfg.setStartStopTime(jdStart, jdStop);
+    pCfg.setDegreeOrder(2, 0);
+    if (icfg > 0) {
+      pCfg.enableCompactStorage();
+    }
+    if (icfg > 1) {
+      pCfg.enableEcfInterpolation();
+    }
+    eom::OrbitDef orbit("binary", pCfg, jdEpoch, oe,
+                        eom::CoordType::keplerian, eom::FrameType::gcrf);
+    std::shared_ptr<eom::Ephemeris> eph = eom::build_orbit(orbit, ecfeci,
+                                                           ceph);
+    auto spEph = std::dynamic_pointer_cast<eom::SpEphemeris>(eph);
+    spEph->write(eph_file);
+    eom::MappedEphemeris mapped("binary", eph_file, ecfeci);
+
+      // Mapped evaluation should reproduce the source ephemeris
+    double max_diff {0.0};
+    for (double dt=0.0; dt<=1.25; dt+=0.01) {
+      eom::JulianDate jd {jdStart + dt};
+      for (auto frame : {eom::EphemFrame::eci, eom::EphemFrame::ecf}) {
+        Eigen::Matrix<double, 6, 1> dx = mapped.getStateVector(jd, frame) -
+                                         eph->getStateVector(jd, frame);
+        max_diff = std::max(max_diff, dx.cwiseAbs().maxCoeff());
+      }
+    }
+    bool times {!(mapped.getBeginTime() < eph->getBeginTime())  &&
+                !(eph->getBeginTime() < mapped.getBeginTime())  &&
+                !(mapped.getEndTime() < eph->getEndTime())  &&
+                !(eph->getEndTime() < mapped.getEndTime())};
+    std::cout << "\n  Storage option " << icfg <<
+                 " max difference, DU and DU/TU: " << max_diff;
+    pass = pass  &&  times  &&  max_diff < 1.0e-14;
+  }
+
+    // Malformed headers and truncated files must be rejected
+  using eom::eph_binary::header;
+  std::vector<char> good {read_file(eph_file)};
+  std::uint64_t huge {~std::uint64_t{0}/2};
+  std::vector<std::vector<char>> bad_files {
+    set_field(good, offsetof(header, magic), 'X'),
+    set_field(good, offsetof(header, version), std::uint32_t{99}),
+    set_field(good, offsetof(header, byte_order), std::uint32_t{0x04030201}),
+    set_field(good, offsetof(header, block_bytes), std::uint64_t{8}),
+    set_field(good, offsetof(header, nnodes), huge),
+    set_field(good, offsetof(header, times_offset), std::uint64_t{0}),
+    set_field(good, offsetof(header, times_offset),
+              reinterpret_cast<const header*>(good.data())->times_offset + 4),
+    set_field(good, offsetof(header, coeff_offset), huge),
+    std::vector<char>(good.begin(), good.begin() + sizeof(header)/2),
+    std::vector<char>(good.begin(), good.end() - 64)
+  };
+  int nrejected {0};
+  for (const auto& bytes : bad_files) {
+    if (rejected(bytes, ecfeci)) {
+      nrejected++;
+    }
+  }
+  std::cout << "\n  Rejected " << nrejected << " of " << bad_files.size() <<
+               " malformed files";
+  pass = pass  &&  nrejected == static_cast<int>(bad_files.size());
+  std::remove(eph_file.c_str());
+
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  EphemerisBinary ===\n\n";
+}
+
+
+}
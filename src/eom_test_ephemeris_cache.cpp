@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <future>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_build.h>
+#include <astro_cached_ephemeris.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ephemeris.h>
+#include <astro_orbit_def.h>
+#include <astro_propagator_config.h>
+
+#include <eom_test.h>
+
+namespace eom_app {
+
+void eom_test_ephemeris_cache()
+{
+  std::cout << "\n\n  === Test:  EphemerisCache ===";
+
+  eom::JulianDate jdEpoch(2460000.5);
+  eom::JulianDate jdStart {jdEpoch + -0.25};
+  eom::JulianDate jdStop {jdEpoch + 1.0};
+    // Integration extends slightly past the ephemeris limits
+  auto ecfeci = std::make_shared<const eom::EcfEciSys>(
+      jdStart + -1.0, jdStop + 1.0, eom::Duration(1.0, phy_const::tu_per_min),
+      nullptr, std::make_shared<const eom::LeapSeconds>(37.0));
+  std::unordered_map<std::string, std::vector<eom::state_vector_rec>> ceph;
+  std::array<double, 6> oe {1.2, 0.05, 0.9, 0.3, 1.1, 0.2};
+  eom::PropagatorConfig pCfg(eom::PropagatorType::sp);
+  pCfg.setStartStopTime(jdStart, jdStop);
+  pCfg.setDegreeOrder(2, 0);
+  eom::OrbitDef orbit("cache", pCfg, jdEpoch, oe,
+                      eom::CoordType::keplerian, eom::FrameType::gcrf);
+  std::shared_ptr<eom::Ephemeris> eph = eom::build_orbit(orbit, ecfeci, ceph);
+
+    // Repeated sample() - all misses, then all hits returning the
+    // values sampled from the wrapped ephemeris.  Few times relative to
+    // the number of slots so none are evicted by the direct mapping.
+  const unsigned long n {20UL};
+  const eom::Duration dt(60.0, phy_const::tu_per_min);
+  eom::CachedEphemeris cached(eph, 65536UL);
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xref(6, n);
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xmiss(6, n);
+  Eigen::Matrix<double, 6, Eigen::Dynamic> xhit(6, n);
+  eph->sample(jdStart, dt, n, eom::EphemFrame::ecf, xref);
+  cached.sample(jdStart, dt, n, eom::EphemFrame::ecf, xmiss);
+  bool pass {cached.getHits() == 0UL  &&  cached.getMisses() == n};
+  cached.sample(jdStart, dt, n, eom::EphemFrame::ecf, xhit);
+  pass = pass  &&  cached.getHits() == n  &&  cached.getMisses() == n;
+  double max_diff {std::max((xmiss - xref).cwiseAbs().maxCoeff(),
+                            (xhit - xref).cwiseAbs().maxCoeff())};
+  std::cout << "\n  Repeated sample hits: " << cached.getHits() <<
+               "  misses: " << cached.getMisses() <<
+               "  max difference, DU and DU/TU: " << max_diff;
+
+    // Position served by a cached state vector at the same time and
+    // frame, but not by one in a different frame
+  const unsigned long isv {n/3UL};
+  eom::JulianDate jdSv {jdStart + isv*dt.getDays()};
+  Eigen::Matrix<double, 3, 1> pos {cached.getPosition(jdSv,
+                                                      eom::EphemFrame::ecf)};
+  bool pos_hit {cached.getHits() == n + 1UL  &&
+                pos == xref.block<3, 1>(0, isv)};
+  cached.getPosition(jdSv, eom::EphemFrame::eci);
+  pos_hit = pos_hit  &&  cached.getMisses() == n + 1UL;
+  std::cout << "\n  Position from cached state: " << pos_hit;
+  pass = pass  &&  max_diff == 0.0  &&  pos_hit;
+
+    // Concurrent random queries on a small table, forcing constant
+    // eviction and contention for slots
+  const unsigned long ntimes {24UL};
+  std::vector<eom::JulianDate> jds;
+  std::array<std::vector<Eigen::Matrix<double, 6, 1>>, 2> xrefs;
+  for (unsigned long ii=0UL; ii<ntimes; ++ii) {
+    jds.push_back(jdStart + 0.05*ii);
+    xrefs[0].push_back(eph->getStateVector(jds.back(), eom::EphemFrame::eci));
+    xrefs[1].push_back(eph->getStateVector(jds.back(), eom::EphemFrame::ecf));
+  }
+  eom::CachedEphemeris tiny(eph, 16UL);
+  const unsigned long nquery {50000UL};
+  auto query = [&](unsigned long seed) {
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<unsigned long> time_dist(0UL, ntimes - 1UL);
+    std::uniform_int_distribution<int> type_dist(0, 3);
+    double dx_max {0.0};
+    for (unsigned long ii=0UL; ii<nquery; ++ii) {
+      auto itime = time_dist(gen);
+      auto type = type_dist(gen);
+      auto iframe = type & 1;
+      auto frame = iframe ? eom::EphemFrame::ecf : eom::EphemFrame::eci;
+      const auto& x = xrefs[iframe][itime];
+      if (type & 2) {
+        Eigen::Matrix<double, 3, 1> dr =
+            tiny.getPosition(jds[itime], frame) - x.block<3, 1>(0, 0);
+        dx_max = std::max(dx_max, dr.cwiseAbs().maxCoeff());
+      } else {
+        Eigen::Matrix<double, 6, 1> dx =
+            tiny.getStateVector(jds[itime], frame) - x;
+        dx_max = std::max(dx_max, dx.cwiseAbs().maxCoeff());
+      }
+    }
+    return dx_max;
+  };
+  std::vector<std::future<double>> queries;
+  for (unsigned long ii=0UL; ii<8UL; ++ii) {
+    queries.push_back(std::async(std::launch::async, query, 1000UL + ii));
+  }
+  double mt_diff {0.0};
+  for (auto& qf : queries) {
+    mt_diff = std::max(mt_diff, qf.get());
+  }
+  bool counts {tiny.getHits() + tiny.getMisses() == 8UL*nquery};
+  std::cout << "\n  Multithreaded hit rate: " << tiny.getHitRate() <<
+               "  max difference, DU and DU/TU: " << mt_diff;
+    // Cached positions may come from getPosition() or getStateVector(),
+    // which are allowed to differ by rounding
+  pass = pass  &&  counts  &&  mt_diff < 1.0e-14;
+
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  EphemerisCache ===\n\n";
+}
+
+
+}
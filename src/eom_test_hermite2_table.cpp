@@ -0,0 +1,151 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <mth_hermite2.h>
+#include <mth_hermite2_table.h>
+
+#include <eom_test.h>
+
+namespace {
+  constexpr int nintervals {100};
+  constexpr int nsamples {10};
+  constexpr double h {0.05};
+
+    // Helix used to generate node values, time in units of h
+  Eigen::Matrix<double, 3, 1> helix_pos(double t)
+  {
+    return {std::cos(t), std::sin(t), 0.1*t};
+  }
+
+  Eigen::Matrix<double, 3, 1> helix_vel(double t)
+  {
+    return {-std::sin(t), std::cos(t), 0.1};
+  }
+
+  Eigen::Matrix<double, 3, 1> helix_acc(double t)
+  {
+    return {-std::cos(t), -std::sin(t), 0.0};
+  }
+
+  std::vector<eom::Hermite2<double, 3>> helix_polynomials()
+  {
+    std::vector<eom::Hermite2<double, 3>> hItps;
+    for (int ii=0; ii<nintervals; ++ii) {
+      double t0 {ii*h};
+      double t1 {t0 + h};
+      hItps.emplace_back(h, helix_pos(t0), helix_vel(t0), helix_acc(t0),
+                            helix_pos(t1), helix_vel(t1), helix_acc(t1));
+    }
+    return hItps;
+  }
+}
+
+namespace eom_app {
+
+void eom_test_hermite2_table()
+{
+  std::cout << "\n\n  === Test:  Hermite2Table ===";
+
+  auto hItps = helix_polynomials();
+  eom::Hermite2Table<double, 3> table;
+  table.reserve(hItps.size());
+  for (const auto& hItp : hItps) {
+    table.push_back(hItp);
+  }
+    // Evaluation through a view of the packed blocks
+  eom::Hermite2Table<double, 3> view(table.data(), table.size());
+
+    // Table evaluation should reproduce Hermite2 other than rounding
+  double max_pos_diff {0.0};
+  double max_vel_diff {0.0};
+  double max_view_diff {0.0};
+  for (unsigned long ii=0; ii<table.size(); ++ii) {
+    for (int jj=0; jj<=nsamples; ++jj) {
+      double dt {jj*h/nsamples};
+      Eigen::Matrix<double, 3, 1> pos = table.getPosition(ii, dt);
+      Eigen::Matrix<double, 3, 1> vel = table.getVelocity(ii, dt);
+      max_pos_diff = std::max(max_pos_diff,
+                              (pos - hItps[ii].getPosition(dt)).norm());
+      max_vel_diff = std::max(max_vel_diff,
+                              (vel - hItps[ii].getVelocity(dt)).norm());
+      max_view_diff = std::max(max_view_diff,
+                               (pos - view.getPosition(ii, dt)).norm() +
+                               (vel - view.getVelocity(ii, dt)).norm());
+    }
+  }
+  constexpr double tol {1.0e-14};
+  std::cout << "\n  Max position difference vs. Hermite2: " << max_pos_diff;
+  std::cout << "\n  Max velocity difference vs. Hermite2: " << max_vel_diff;
+  std::cout << "\n  Max difference of view vs. table:     " << max_view_diff;
+  std::cout << "\n  Full precision storage error bound:   " <<
+               table.getMaxPositionError() << "  " <<
+               table.getMaxVelocityError();
+  bool pass {max_pos_diff < tol  &&  max_vel_diff < tol  &&
+             max_view_diff == 0.0  &&
+             table.getMaxPositionError() == 0.0  &&
+             table.getMaxVelocityError() == 0.0};
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  Hermite2Table ===\n\n";
+}
+
+
+void eom_test_hermite2_table_compact()
+{
+  std::cout << "\n\n  === Test:  Hermite2TableCompact ===";
+
+  auto hItps = helix_polynomials();
+  eom::Hermite2Table<double, 3, float> table;
+  table.reserve(hItps.size());
+  for (const auto& hItp : hItps) {
+    table.push_back(hItp);
+  }
+
+    // Error due to single precision derivative coefficients must not
+    // exceed the bound accumulated as polynomials were added
+  double max_pos_diff {0.0};
+  double max_vel_diff {0.0};
+  for (unsigned long ii=0; ii<table.size(); ++ii) {
+    for (int jj=0; jj<=nsamples; ++jj) {
+      double dt {jj*h/nsamples};
+      Eigen::Matrix<double, 3, 1> dp = table.getPosition(ii, dt) -
+                                       hItps[ii].getPosition(dt);
+      Eigen::Matrix<double, 3, 1> dv = table.getVelocity(ii, dt) -
+                                       hItps[ii].getVelocity(dt);
+      max_pos_diff = std::max(max_pos_diff, dp.cwiseAbs().maxCoeff());
+      max_vel_diff = std::max(max_vel_diff, dv.cwiseAbs().maxCoeff());
+    }
+  }
+  std::cout << "\n  Block size, full vs. compact:   " <<
+               eom::Hermite2Table<double, 3>::blockSize() << "  " <<
+               eom::Hermite2Table<double, 3, float>::blockSize();
+  std::cout << "\n  Max position difference, bound: " << max_pos_diff <<
+               "  " << table.getMaxPositionError();
+  std::cout << "\n  Max velocity difference, bound: " << max_vel_diff <<
+               "  " << table.getMaxVelocityError();
+    // Allow for rounding in double precision evaluation
+  constexpr double eps {1.0e-15};
+  bool pass {max_pos_diff <= table.getMaxPositionError() + eps  &&
+             max_vel_diff <= table.getMaxVelocityError() + eps  &&
+             table.getMaxPositionError() > 0.0  &&
+             eom::Hermite2Table<double, 3, float>::blockSize() <
+             eom::Hermite2Table<double, 3>::blockSize()};
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  Hermite2TableCompact ===\n\n";
+}
+
+
+}
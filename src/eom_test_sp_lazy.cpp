@@ -0,0 +1,194 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_build.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ephemeris.h>
+#include <astro_mapped_ephemeris.h>
+#include <astro_orbit_def.h>
+#include <astro_propagator_config.h>
+#include <astro_sp_ephemeris.h>
+
+#include <eom_test.h>
+
+namespace {
+  const std::string eph_file {"eom_test_sp_lazy.eomb"};
+
+    // Eager when seg_days is zero, else lazy with the given segment cap
+  std::shared_ptr<eom::Ephemeris>
+  build(const eom::JulianDate& jdEpoch,
+        const eom::JulianDate& jdStart, const eom::JulianDate& jdStop,
+        double seg_days, unsigned long max_segments,
+        const std::shared_ptr<const eom::EcfEciSys>& ecfeci)
+  {
+    std::unordered_map<std::string, std::vector<eom::state_vector_rec>> ceph;
+    eom::PropagatorConfig pCfg(eom::PropagatorType::sp);
+    pCfg.setStartStopTime(jdStart, jdStop);
+    pCfg.setStepSize(eom::Duration(1.0, phy_const::tu_per_min));
+    pCfg.setGravityModel(eom::GravityModel::std);
+    pCfg.setDegreeOrder(4, 4);
+    pCfg.enableEcfInterpolation();
+    if (seg_days > 0.0) {
+      pCfg.setLazyPropagation(eom::Duration(seg_days, phy_const::tu_per_day),
+                              max_segments);
+    }
+    std::array<double, 6> oe {1.2, 0.05, 0.9, 0.3, 1.1, 0.2};
+    eom::OrbitDef orbit("lazy", pCfg, jdEpoch, oe,
+                        eom::CoordType::keplerian, eom::FrameType::gcrf);
+    return eom::build_orbit(orbit, ecfeci, ceph);
+  }
+
+    // Max state vector difference over a set of times and frames
+  double max_difference(const eom::Ephemeris& eph,
+                        const std::vector<eom::JulianDate>& jds,
+                        const std::vector<unsigned long>& order,
+                        const std::array<std::vector<Eigen::Matrix<double,
+                                         6, 1>>, 2>& xrefs)
+  {
+    double dx_max {0.0};
+    for (auto ii : order) {
+      for (int iframe=0; iframe<2; ++iframe) {
+        auto frame = iframe ? eom::EphemFrame::ecf : eom::EphemFrame::eci;
+        Eigen::Matrix<double, 6, 1> dx = eph.getStateVector(jds[ii], frame) -
+                                         xrefs[iframe][ii];
+        dx_max = std::max(dx_max, dx.cwiseAbs().maxCoeff());
+      }
+    }
+    return dx_max;
+  }
+}
+
+namespace eom_app {
+
+void eom_test_sp_lazy()
+{
+  std::cout << "\n\n  === Test:  SpLazy ===";
+
+  eom::JulianDate jdStart(2460000.25);
+  eom::JulianDate jdStop {jdStart + 1.25};
+    // Integration extends slightly past the ephemeris limits
+  auto ecfeci = std::make_shared<const eom::EcfEciSys>(
+      jdStart + -1.0, jdStop + 1.0, eom::Duration(1.0, phy_const::tu_per_min),
+      nullptr, std::make_shared<const eom::LeapSeconds>(37.0));
+
+    // Epoch within the span, generating forward and backward legs, and
+    // at the end, generating ephemeris almost entirely backward
+  bool pass {true};
+  const double seg_days {0.1};
+  for (auto jdEpoch : {jdStart + 0.25, jdStop}) {
+    auto eager = build(jdEpoch, jdStart, jdStop, 0.0, 0UL, ecfeci);
+    std::vector<eom::JulianDate> jds;
+    std::array<std::vector<Eigen::Matrix<double, 6, 1>>, 2> xrefs;
+    for (double dt=0.0; dt<=1.25; dt+=0.0123) {
+      jds.push_back(jdStart + dt);
+      xrefs[0].push_back(eager->getStateVector(jds.back(),
+                                               eom::EphemFrame::eci));
+      xrefs[1].push_back(eager->getStateVector(jds.back(),
+                                               eom::EphemFrame::ecf));
+    }
+      // Requests sweeping away from the epoch, then back again, so
+      // capped segments are released and regenerated
+    std::vector<unsigned long> order(jds.size());
+    for (unsigned long ii=0UL; ii<order.size(); ++ii) {
+      order[ii] = ii;
+    }
+    std::sort(order.begin(), order.end(),
+              [&jds, &jdEpoch](unsigned long a, unsigned long b) {
+                return std::abs(jds[a] - jdEpoch) <
+                       std::abs(jds[b] - jdEpoch);
+              });
+    order.insert(order.end(), order.rbegin(), order.rend());
+
+      // Lazy generation integrates the same steps as eager generation,
+      // differing by rounding where ECF conversions restart with each
+      // segment.  Regenerated segments may differ at the integration
+      // error level.
+    auto lazy = build(jdEpoch, jdStart, jdStop, seg_days, 0UL, ecfeci);
+    auto capped = build(jdEpoch, jdStart, jdStop, seg_days, 2UL, ecfeci);
+    double lazy_diff {max_difference(*lazy, jds, order, xrefs)};
+    double capped_diff {max_difference(*capped, jds, order, xrefs)};
+    std::cout << "\n  Epoch offset " << (jdEpoch - jdStart) << " days" <<
+                 "\n    Lazy max difference, DU and DU/TU: " << lazy_diff <<
+                 "\n    Capped max difference, DU and DU/TU: " <<
+                 capped_diff;
+    pass = pass  &&  lazy_diff < 1.0e-12  &&  capped_diff < 1.0e-9;
+
+      // Concurrent random requests on fresh instances, generating and
+      // releasing segments while others read
+    auto lazy_mt = build(jdEpoch, jdStart, jdStop, seg_days, 0UL, ecfeci);
+    auto capped_mt = build(jdEpoch, jdStart, jdStop, seg_days, 2UL, ecfeci);
+    auto query = [&](const eom::Ephemeris& eph, unsigned long seed) {
+      std::mt19937_64 gen(seed);
+      std::uniform_int_distribution<unsigned long> dist(0UL,
+                                                        jds.size() - 1UL);
+      std::vector<unsigned long> rorder(500UL);
+      for (auto& ii : rorder) {
+        ii = dist(gen);
+      }
+      return max_difference(eph, jds, rorder, xrefs);
+    };
+    std::vector<std::future<double>> lazy_queries;
+    std::vector<std::future<double>> capped_queries;
+    for (unsigned long ii=0UL; ii<8UL; ++ii) {
+      lazy_queries.push_back(std::async(std::launch::async, query,
+                                        std::cref(*lazy_mt), 100UL + ii));
+      capped_queries.push_back(std::async(std::launch::async, query,
+                                          std::cref(*capped_mt),
+                                          200UL + ii));
+    }
+    double lazy_mt_diff {0.0};
+    double capped_mt_diff {0.0};
+    for (unsigned long ii=0UL; ii<lazy_queries.size(); ++ii) {
+      lazy_mt_diff = std::max(lazy_mt_diff, lazy_queries[ii].get());
+      capped_mt_diff = std::max(capped_mt_diff, capped_queries[ii].get());
+    }
+    std::cout << "\n    Multithreaded lazy max difference: " <<
+                 lazy_mt_diff <<
+                 "\n    Multithreaded capped max difference: " <<
+                 capped_mt_diff;
+    pass = pass  &&  lazy_mt_diff < 1.0e-12  &&  capped_mt_diff < 1.0e-9;
+
+      // Writing regenerates released segments over the full span
+    auto spCapped = std::dynamic_pointer_cast<eom::SpEphemeris>(capped);
+    spCapped->write(eph_file);
+    double write_diff {0.0};
+    {
+      eom::MappedEphemeris mapped("lazy", eph_file, ecfeci);
+      write_diff = max_difference(mapped, jds, order, xrefs);
+    }
+    std::remove(eph_file.c_str());
+    std::cout << "\n    Written after release max difference: " <<
+                 write_diff;
+    pass = pass  &&  write_diff < 1.0e-9;
+  }
+
+  std::cout << "\n  " << (pass ? "Pass" : "Fail");
+
+  std::cout << "\n  === End Test:  SpLazy ===\n\n";
+}
+
+
+}
@@ -15,6 +15,7 @@
 #include <cal_duration.h>
 #include <cal_greg_date.h>
 #include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
 #include <astro_ecfeci_sys.h>
 #include <astro_ephemeris.h>
 #include <astro_sun_meeus.h>
@@ -46,7 +47,8 @@ void eom_test_sun()
           std::make_shared<eom::EcfEciSys>(jdStart,
                                            jdStop+1.0,
                                            dt,
-                                           nullptr);
+                                           nullptr,
+                                           std::make_shared<const eom::LeapSeconds>());
 
   std::shared_ptr<const eom::Ephemeris> ephPtr =
           std::make_shared<eom::SunMeeus>(ecfeci);
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <cal_julian_date.h>
+#include <cal_leap_seconds.h>
+#include <astro_build.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_ephemeris.h>
+#include <astro_orbit_def.h>
+#include <astro_propagator_config.h>
+
+#include <eom_test.h>
+
+namespace {
+    // Moderately eccentric orbit integrated one day forward and a
+    // quarter day backward from epoch
+  const eom::JulianDate jd_epoch(2460000.5);
+  const eom::JulianDate jd_start {jd_epoch + -0.25};
+  const eom::JulianDate jd_stop {jd_epoch + 1.0};
+  const std::array<double, 6> oe {1.3, 0.15, 0.9, 0.3, 1.1, 0.2};
+
+  /*
+   * Maximum position difference, meters, between two-body SP
+   * ephemeris generated with the given integrator and the Kepler
+   * propagator
+   */
+  double two_body_error(const eom::PropagatorConfig& spCfg)
+  {
+      // Integration extends slightly past the ephemeris limits
+    auto ecfeci = std::make_shared<const eom::EcfEciSys>(
+        jd_start + -1.0, jd_stop + 1.0,
+        eom::Duration(10.0, phy_const::tu_per_min), nullptr,
+        std::make_shared<const eom::LeapSeconds>(37.0));
+    std::unordered_map<std::string, std::vector<eom::state_vector_rec>> ceph;
+
+    eom::PropagatorConfig pCfg {spCfg};
+    pCfg.setStartStopTime(jd_start, jd_stop);
+    pCfg.setDegreeOrder(0, 0);
+    eom::OrbitDef spOrbit("sp", pCfg, jd_epoch, oe,
+                          eom::CoordType::keplerian, eom::FrameType::gcrf);
+    eom::OrbitDef kepOrbit("kepler",
+                           eom::PropagatorConfig(eom::PropagatorType::kepler1),
+                           jd_epoch, oe,
+                           eom::CoordType::keplerian, eom::FrameType::gcrf);
+    auto spEph = eom::build_orbit(spOrbit, ecfeci, ceph);
+    auto kepEph = eom::build_orbit(kepOrbit, ecfeci, ceph);
+
+    double max_err {0.0};
+    for (double dt=0.0; dt<=1.25; dt+=0.005) {
+      eom::JulianDate jd {jd_start + dt};
+      Eigen::Matrix<double, 3, 1> dr =
+          spEph->getPosition(jd, eom::EphemFrame::eci) -
+          kepEph->getPosition(jd, eom::EphemFrame::eci);
+      max_err = std::max(max_err, dr.norm());
+    }
+    return phy_const::m_per_du*max_err;
+  }
+
+  /*
+   * Report two-body error for an integrator against a tolerance, meters
+   */
+  void report(const std::string& name, const eom::PropagatorConfig& pCfg,
+              double tol)
+  {
+    double err {two_body_error(pCfg)};
+    std::cout << "\n  " << name << " max position error vs. Kepler, m: " <<
+                 err;
+    std::cout << "\n  " << ((err < tol) ? "Pass" : "Fail");
+  }
+}
+
+namespace eom_app {
+
+void eom_test_rkf78()
+{
+  std::cout << "\n\n  === Test:  RKF78 ===";
+
+  eom::PropagatorConfig pCfg(eom::PropagatorType::sp);
+  pCfg.setPropagator(eom::Propagator::rkf78);
+  pCfg.setStepSize(eom::Duration(5.0, phy_const::tu_per_min));
+  pCfg.setTolerance(1.0e-13, 1.0e-13);
+  report("RKF78", pCfg, 0.01);
+
+  std::cout << "\n  === End Test:  RKF78 ===\n\n";
+}
+
+
+void eom_test_adams()
+{
+  std::cout << "\n\n  === Test:  AdamsVSVO ===";
+
+  eom::PropagatorConfig pCfg(eom::PropagatorType::sp);
+  pCfg.setPropagator(eom::Propagator::adams);
+  pCfg.setStepSize(eom::Duration(5.0, phy_const::tu_per_min));
+  pCfg.setTolerance(1.0e-13, 1.0e-13);
+  report("AdamsVSVO", pCfg, 0.01);
+
+  std::cout << "\n  === End Test:  AdamsVSVO ===\n\n";
+}
+
+
+void eom_test_gj8()
+{
+  std::cout << "\n\n  === Test:  GJ8 ===";
+
+  eom::PropagatorConfig pCfg(eom::PropagatorType::sp);
+  pCfg.setPropagator(eom::Propagator::gj8);
+  pCfg.setStepSize(eom::Duration(1.0, phy_const::tu_per_min));
+  report("GJ8", pCfg, 0.1);
+
+  std::cout << "\n  === End Test:  GJ8 ===\n\n";
+}
+
+
+}
@@ -6,198 +6,163 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
-#include <execution>
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
-#include <iomanip>
-#include <memory>
-#include <stdexcept>
+#include <sstream>
+#include <streambuf>
 #include <string>
-#include <unordered_map>
-#include <utility>
+#include <thread>
 #include <vector>
 
-#include <utl_const.h>
-#include <phy_const.h>
-#include <cal_julian_date.h>
-#include <astro_build.h>
-#include <astro_ecfeci_sys.h>
-#include <astro_eop_sys.h>
-#include <astro_ephemeris.h>
-#include <astro_ephemeris_file.h>
-#include <astro_ground_point.h>
-#include <astro_keplerian.h>
-#include <astro_orbit_def.h>
-#include <astro_rel_orbit_def.h>
-#include <axs_gp_access_def.h>
-#include <axs_interval.h>
-#include <axs_gp_access.h>
-
-#include <eom_command.h>
-#include <eom_config.h>
+#include <astro_ecfeci_registry.h>
 
 #include <eomx.h>
-#include <eomx_exception.h>
+
+namespace {
+    // Destination of console output written by the current thread's
+    // scenario, if being captured
+  thread_local std::streambuf* scenario_buf {nullptr};
+
+    // Replaces the std::cout and std::cerr buffers in batch mode,
+    // directing output to the scenario buffer of the writing thread.
+    // Output from threads not running a scenario passes through.
+  class ScenarioStreambuf : public std::streambuf {
+  public:
+    explicit ScenarioStreambuf(std::streambuf* dest) : m_dest {dest}
+    {
+    }
+
+  protected:
+    int overflow(int ch) override
+    {
+      if (traits_type::eq_int_type(ch, traits_type::eof())) {
+        return traits_type::not_eof(ch);
+      }
+      char c {traits_type::to_char_type(ch)};
+      return target()->sputn(&c, 1) == 1 ? ch : traits_type::eof();
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+      return target()->sputn(s, n);
+    }
+
+    int sync() override
+    {
+      return target()->pubsync();
+    }
+
+  private:
+    std::streambuf* target() const
+    {
+      return scenario_buf != nullptr ? scenario_buf : m_dest;
+    }
+
+    std::streambuf* m_dest {nullptr};
+  };
+
+    // Run a scenario with console output captured, returning the output
+  std::string run_captured(const std::string& fname,
+                           eom::EcfEciRegistry& f2iRegistry)
+  {
+    std::ostringstream out;
+    scenario_buf = out.rdbuf();
+    std::cout << "\n\nScenario:  " << fname << '\n';
+      // A failed scenario shouldn't end the batch
+    try {
+      if (eomx_run_scenario(fname, f2iRegistry) != 0) {
+        std::cerr << "\nScenario " << fname << " failed\n";
+      }
+    } catch (const std::exception& e) {
+      std::cerr << "\nScenario " << fname << " failed:  " <<
+                   e.what() << '\n';
+    }
+    scenario_buf = nullptr;
+    return out.str();
+  }
+}
 
 /**
  * Equations of Motion Executable:  An application focused on astrodynamics
  * related problems.  This program parses an input file building models and
- * commands to be applied to those models.
+ * commands to be applied to those models.  In batch mode, the input files
+ * listed in the batch file are run concurrently, sharing ECF/ECI
+ * resources where time spans overlap.  Console output of each scenario
+ * is captured and written in batch file order once the scenario
+ * completes.
  *
  * @author  Kurt Motekew
  */
 int main(int argc, char* argv[])
 {
     // Check for filename
-  if (argc < 2  ||  argc > 3) {
+  bool batch {argc > 1  &&  std::string(argv[1]) == "-b"};
+  int nargs {batch ? argc - 1 : argc};
+  if (nargs < 2  ||  nargs > 3) {
     std::cerr << "\nProper use is:  " << argv[0] << " <input_file_name> or";
     std::cerr << "\n                " << argv[0] << " <input_file_name>" <<
-                                                    " <eop__file_name>\n";
+                                                    " <eop__file_name> or";
+    std::cerr << "\n                " << argv[0] << " -b <batch_file_name>" <<
+                                                    " [<eop__file_name>]\n";
     return 0;
   }
+  int iarg {batch ? 2 : 1};
 
-    // General configuration parameter for the simulation
-  eom_app::EomConfig cfg;
-    // Orbit definitions, used to initialize propagators and/or generate
-    // classes with buffered ephemeris
-  std::vector<eom::OrbitDef> orbit_defs;
-    // Orbit definitions based on other orbits.  As with orbit_defs,
-    // will be used to initialize propagators and/or generate classes
-    // with buffered ephemeris
-  std::vector<eom::RelOrbitDef> rel_orbit_defs;
-    // Ephemeris file definitions - not necessarily an orbit
-  std::vector<eom::EphemerisFile> eph_file_defs;
-    // Earth fixed points (ground points)
-  std::unordered_map<std::string,
-                     std::shared_ptr<eom::GroundPoint>> ground_points;
-    // Definitions of orbit to ground access analysis requests and
-    // access analysis producers
-  std::vector<eom::GpAccessDef> gp_access_defs;
-    // The commands populated by cmdBuilder
-  std::vector<std::shared_ptr<eom_app::EomCommand>> commands;
-
-    // Parse input file
-  try {
-    eomx_parse_input_file(argv[1],
-                          cfg,
-                          orbit_defs, rel_orbit_defs, eph_file_defs,
-                          ground_points, gp_access_defs,
-                          commands);
-  } catch (const eom_app::EomXException& exe) {
-    std::cerr << "\nError parsing input file:  " << exe.what() << '\n';
-    return 0;
-  }
-    // ...and print scenario - print simulation components as created
-  std::cout << cfg << '\n';
+    // ECF/ECI resources shared by all scenarios
+  eom::EcfEciRegistry f2iRegistry(nargs > 2 ? argv[iarg+1] : "");
 
-    // Print ground points
-  if (ground_points.size() > 0) {
-    std::cout << "\nGround point Definitions";
-  }
-  for (const auto& [name, gp] : ground_points) {
-    std::cout << "\n  " << name << ":  " << *gp;
-  }
-
-    // Determine time span that must be supported by the simulation,
-    // and generate ECF/ECI service
-  std::shared_ptr<eom::EcfEciSys> f2iSys {nullptr};
-  try {
-    auto [minJd, maxJd] = eomx_simulation_time(cfg, orbit_defs);
-
-    std::shared_ptr<eom::EopSys> eopSys = nullptr;
-    if (argc > 2) {
-     eopSys = std::make_shared<eom::EopSys>(argv[2], minJd, maxJd);
-    }
-    f2iSys = std::make_shared<eom::EcfEciSys>(minJd,
-                                              maxJd,
-                                              cfg.getEcfEciRate(),
-                                              eopSys);
-  } catch (const eom_app::EomXException& exe) {
-    std::cerr << "\nSimulatio Time Error:  " << exe.what() << '\n';
+  if (!batch) {
+    eomx_run_scenario(argv[iarg], f2iRegistry);
     return 0;
   }
 
-    // Generate ephemerides
-  auto ephemerides = eomx_gen_ephemerides(cfg,
-                                          orbit_defs,
-                                          rel_orbit_defs,
-                                          eph_file_defs,
-                                          f2iSys);
-
-    // Print derived orbit names
-  if (rel_orbit_defs.size() > 0) {
-    std::cout << "\nDerived Orbits";
-  }
-  for (const eom::RelOrbitDef& relOrbit : rel_orbit_defs) {
-    std::cout << "\n  " << relOrbit.getOrbitName() <<
-                 "  derived from:  " <<
-                 relOrbit.getTemplateOrbitName();
-  }
-    // Print all orbits as orbital elements
-  std::cout << "\n\nGenerated Orbits";
-  for (const auto& [name, eph] : ephemerides) {
-    std::cout << "\n  " << name;
-    std::cout << "\n  " << eph->getEpoch().to_str() << "    GCRF";
-    eom::Keplerian oeCart(eph->getStateVector(eph->getEpoch(),
-                                              eom::EphemFrame::eci));
-    std::cout << oeCart;
-  }
-
-    // Generate access analysis
-  auto gp_accessors = eomx_gen_gp_accesses(cfg,
-                                           ground_points,
-                                           ephemerides,
-                                           gp_access_defs,
-                                           f2iSys);
-
-    // Print access results here for now
-  if (gp_access_defs.size() > 0) {
-    std::cout << std::setprecision(1);
+    // Batch file lists one input file per line
+  std::ifstream ifs(argv[iarg]);
+  if (!ifs.is_open()) {
+    std::cerr << "\nCan't open batch file " << argv[iarg] << '\n';
+    return 0;
   }
-  for (const eom::GpAccessDef& axses : gp_access_defs) {
-    std::string key {axses.getGpName() + axses.getOrbitName()};
-    try {
-      std::shared_ptr<eom::GpAccess> axs = gp_accessors.at(key);
-      std::cout << "\n\n  Access for " << axs->getOrbitName() <<
-                         " against " << axs->getGpName();
-      for (const eom::axs_interval& rise_set : (*axs)) {
-        std::cout << '\n' << rise_set.rise.to_str() <<
-            "  " << rise_set.set.to_str() << "    {" <<
-            utl_const::deg_per_rad*std::asin(rise_set.rasel_rise.sinel) <<
-            ", " <<
-            utl_const::deg_per_rad*std::asin(rise_set.rasel_set.sinel) <<
-            "} deg Elevation" <<
-            "    {" <<
-            utl_const::deg_per_rad*rise_set.rasel_rise.azimuth <<
-            ", " <<
-            utl_const::deg_per_rad*rise_set.rasel_set.azimuth <<
-            "} deg Azimuth";
-      }
-    } catch (const std::out_of_range& oor) {
-      std::cerr << "\nCould not locate " << key <<
-                   " for access analysis\n";
+  std::vector<std::string> scenarios;
+  std::string input_line;
+  while (std::getline(ifs, input_line)) {
+    if (input_line.empty()  ||  input_line.front() == '#') {
+      continue;
     }
+    scenarios.push_back(input_line);
   }
 
-  //
-  // Model and command lists completed - no further modifications
-  // Validate (exit on failure) & Execute Commands
-  //
-
-  for (auto& cmd : commands) {
-    try {
-      cmd->validate(ephemerides);
-    } catch (const eom_app::CmdValidateException& cve) {
-      std::cerr << "\n\nError Validating Command: " << cve.what() << '\n';
-      return 0;
+    // Route console output through scenario capture, restoring the
+    // original buffers once all scenarios complete
+  std::streambuf* cout_buf {std::cout.rdbuf()};
+  std::streambuf* cerr_buf {std::cerr.rdbuf()};
+  ScenarioStreambuf cout_router(cout_buf);
+  ScenarioStreambuf cerr_router(cerr_buf);
+  std::cout.rdbuf(&cout_router);
+  std::cerr.rdbuf(&cerr_router);
+
+    // Limit the number of scenarios in progress, writing output in
+    // batch file order
+  const unsigned long max_running {std::max(1U,
+                                       std::thread::hardware_concurrency())};
+  std::deque<std::future<std::string>> running;
+  for (const auto& fname : scenarios) {
+    if (running.size() >= max_running) {
+      std::cout << running.front().get() << std::flush;
+      running.pop_front();
     }
+    running.push_back(std::async(std::launch::async, run_captured,
+                                 fname, std::ref(f2iRegistry)));
   }
-
-  for (auto& cmd : commands) {
-    cmd->execute();
+  while (!running.empty()) {
+    std::cout << running.front().get() << std::flush;
+    running.pop_front();
   }
 
-
-  std::cout << "\n\n";
-
+  std::cout.rdbuf(cout_buf);
+  std::cerr.rdbuf(cerr_buf);
 }
-
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <iostream>
+#include <stdexcept>
+#include <fstream>
+#include <string>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+#include <Eigen/Dense>
+
+#include <phy_const.h>
+#include <cal_duration.h>
+#include <astro_orbit_def.h>
+#include <astro_dispersion_def.h>
+#include <astro_dispersion_stats.h>
+#include <astro_ephemeris.h>
+#include <astro_ecfeci_sys.h>
+#include <astro_build.h>
+
+#include <eomx.h>
+#include <eomx_exception.h>
+
+static void print_dispersion(const std::string& file_name,
+                             const eom_app::EomConfig& cfg,
+                             const eom::Duration& dt,
+                             const eom::DispersionDef& dispDef,
+                             const eom::DispersionStats& stats);
+
+/**
+ * See eomx.h
+ */
+void eomx_gen_dispersions(
+    const eom_app::EomConfig& cfg,
+    const std::vector<eom::OrbitDef>& orbit_defs,
+    const std::vector<eom::DispersionDef>& dispersion_defs,
+    const std::shared_ptr<const eom::EcfEciSys>& f2iSys,
+    const std::unordered_map<std::string,
+                             std::vector<eom::state_vector_rec>>& celestials)
+{
+  if (dispersion_defs.size() > 0) {
+    std::cout << "\n\nDispersions";
+  }
+
+    // Statistics over the simulation time at the output rate, defaulting
+    // to 60 seconds
+  eom::Duration dt {cfg.getOutputRate()};
+  if (dt.getTu() <= 0.0) {
+    dt = eom::Duration(60.0, phy_const::tu_per_sec);
+  }
+  double tot_tu {phy_const::tu_per_day*(cfg.getStopTime() -
+                                        cfg.getStartTime())};
+  unsigned long points {static_cast<unsigned long>(tot_tu/dt.getTu())};
+  points++;
+
+    // One dispersion at a time - sampled orbits are generated
+    // concurrently by build_dispersion()
+  for (const auto& dispDef : dispersion_defs) {
+    const eom::OrbitDef* templateOrbit {nullptr};
+    for (const auto& orbit : orbit_defs) {
+      if (orbit.getOrbitName() == dispDef.getTemplateOrbitName()) {
+        templateOrbit = &orbit;
+        break;
+      }
+    }
+    if (templateOrbit == nullptr) {
+      throw eom_app::EomXException("eomx_gen_dispersions() "
+                                   "Invalid Dispersion template name: " +
+                                   dispDef.getTemplateOrbitName());
+    }
+    try {
+      eom::DispersionStats stats = eom::build_dispersion(dispDef,
+                                                         *templateOrbit,
+                                                         cfg.getStartTime(),
+                                                         dt, points,
+                                                         f2iSys, celestials);
+      std::cout << "\n  " << dispDef.getName() << ":  " <<
+                   stats.getSamples() << " samples of " <<
+                   dispDef.getTemplateOrbitName() << " written to " <<
+                   dispDef.getFileName();
+      print_dispersion(dispDef.getFileName(), cfg, dt, dispDef, stats);
+    } catch (const std::invalid_argument& ia) {
+      throw eom_app::EomXException("eomx_gen_dispersions() " +
+                                   dispDef.getName() + ":  " + ia.what());
+    }
+  }
+}
+
+
+/*
+ * Elapsed time followed by the mean GCRF state and the upper triangular
+ * covariance, row by row, in output units
+ */
+static void print_dispersion(const std::string& file_name,
+                             const eom_app::EomConfig& cfg,
+                             const eom::Duration& dt,
+                             const eom::DispersionDef& dispDef,
+                             const eom::DispersionStats& stats)
+{
+  std::ofstream fout(file_name);
+  if (!fout.is_open()) {
+    std::cerr << "\nCan't open " << file_name << '\n';
+    return;
+  }
+
+    // DU and TU to output units, position then velocity
+  Eigen::Matrix<double, 6, 1> dutu2io;
+  dutu2io.block<3, 1>(0, 0).setConstant(cfg.getIoPerDu());
+  dutu2io.block<3, 1>(3, 0).setConstant(cfg.getIoPerDu()/cfg.getIoPerTu());
+  double dt_io {cfg.getIoPerTu()*dt.getTu()};
+
+  fout << "# Dispersion " << dispDef.getName() << " of " <<
+          dispDef.getTemplateOrbitName() << ", " << stats.getSamples() <<
+          " samples, seed " << dispDef.getSeed();
+  fout << "\n# Start " << cfg.getStartTime().to_dmy_str() << " UTC";
+  fout << "\n# Elapsed time (" << cfg.getIoTimeUnits() << "),";
+  fout << " mean GCRF position (" << cfg.getIoDistansUnits() << ")";
+  fout << " and velocity (" << cfg.getIoDistansUnits() << '/' <<
+          cfg.getIoTimeUnits() << "),";
+  fout << "\n# upper triangular covariance, row by row";
+
+  fout << std::scientific;
+  fout.precision(16);
+  for (unsigned long ii=0UL; ii<stats.getPoints(); ++ii) {
+    fout << "\n " << ii*dt_io;
+    Eigen::Matrix<double, 6, 1> mean = stats.getMean(ii);
+    for (int jj=0; jj<6; ++jj) {
+      fout << "  " << dutu2io(jj)*mean(jj);
+    }
+    Eigen::Matrix<double, 6, 6> cov = stats.getCovariance(ii);
+    for (int jj=0; jj<6; ++jj) {
+      for (int kk=jj; kk<6; ++kk) {
+        fout << "  " << dutu2io(jj)*dutu2io(kk)*cov(jj, kk);
+      }
+    }
+  }
+  fout << '\n';
+  fout.close();
+}
@@ -17,10 +17,12 @@
 #include <astro_rel_orbit_def.h>
 #include <astro_ephemeris_file.h>
 #include <astro_ephemeris.h>
+#include <astro_cached_ephemeris.h>
 #include <astro_ecfeci_sys.h>
 #include <astro_build.h>
 
 #include <eomx.h>
+#include <eomx_exception.h>
 
 /**
  * See eomx.h
@@ -30,17 +32,10 @@ eomx_gen_ephemerides(const eom_app::EomConfig& cfg,
                      const std::vector<eom::OrbitDef>& orbit_defs,
                      const std::vector<eom::RelOrbitDef>& rel_orbit_defs,
                      const std::vector<eom::EphemerisFile>& eph_file_defs,
-                     const std::shared_ptr<eom::EcfEciSys>& f2iSys)
+                     const std::shared_ptr<const eom::EcfEciSys>& f2iSys,
+                     const std::unordered_map<std::string,
+                             std::vector<eom::state_vector_rec>>& celestials)
 {
-    // Celestial Ephemeris objects - read ephemerides from files
-  std::unordered_map<std::string,
-                     std::vector<eom::state_vector_rec>> celestials;
-  std::vector<std::string> celestial_names = cfg.getCelestials();
-  for (const auto& name : celestial_names) {
-    celestials[name] = eom::build_celestial(name, cfg.getStartTime(),
-                                                  cfg.getStopTime());
-  }
-
     // Ephemeris objects - build file based, then initial state based,
     // then relative orbits
   std::unordered_map<std::string,
@@ -56,14 +51,9 @@ eomx_gen_ephemerides(const eom_app::EomConfig& cfg,
   }
 
   {//==>
-    // Generate orbit definitions in parallel 
-  std::vector<std::unique_ptr<eom::Ephemeris>> ephvec(orbit_defs.size());
-  std::transform(std::execution::par,
-                 orbit_defs.begin(), orbit_defs.end(), ephvec.begin(),
-                 [f2iSys, &celestials](const auto& orbit) {
-                   return eom::build_orbit(orbit, f2iSys, celestials);
-                 }
-  );
+    // Generate orbit definitions in parallel, ensembles in lockstep
+  std::vector<std::unique_ptr<eom::Ephemeris>> ephvec =
+      eom::build_orbits(orbit_defs, f2iSys, celestials);
     // Move ephemerides from temporary vector to ephemeris map
   for (unsigned int ii=0; ii<ephvec.size(); ++ii) {
     auto name = ephvec[ii]->getName();
@@ -105,6 +95,16 @@ eomx_gen_ephemerides(const eom_app::EomConfig& cfg,
   }
   }//<==
 
+    // Wrap ephemerides to be shared through a cache - after relative
+    // orbits are built so they reference the original
+  for (const auto& [name, slots] : cfg.getEphemerisCaches()) {
+    auto eph = ephemerides.find(name);
+    if (eph == ephemerides.end()) {
+      throw eom_app::EomXException("eomx_gen_ephemerides() "
+                                   "Invalid EphemerisCache name: " + name);
+    }
+    eph->second = std::make_shared<eom::CachedEphemeris>(eph->second, slots);
+  }
 
   return ephemerides;
 }
@@ -7,13 +7,17 @@
  */
 
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include <execution>
 
+#include <astro_build.h>
 #include <astro_ecfeci_sys.h>
+#include <astro_ephemeris_variant.h>
 #include <astro_ground_point.h>
 #include <axs_gp_access_def.h>
 #include <axs_gp_access.h>
@@ -37,7 +41,7 @@ eomx_gen_gp_accesses(
     const std::unordered_map<std::string,
                              std::shared_ptr<eom::Ephemeris>>& ephemerides,
     const std::vector<eom::GpAccessDef>& gp_access_defs,
-    const std::shared_ptr<eom::EcfEciSys>& f2iSys)
+    const std::shared_ptr<const eom::EcfEciSys>& f2iSys)
 {
 
     // Create access analysis objects with resources
@@ -69,12 +73,19 @@ eomx_gen_gp_accesses(
                                                  xcs,
                                                  eph_ptr);
       } else {
-        gp_accessors[gp_ptr->getName() + eph_ptr->getName()] =
-            std::make_shared<eom::GpAccessStd>(cfg.getStartTime(),
-                                               cfg.getStopTime(),
-                                               *gp_ptr,
-                                               xcs,
-                                               eph_ptr);
+          // Instantiated per concrete ephemeris type
+        gp_accessors[gp_ptr->getName() + eph_ptr->getName()] = std::visit(
+            [&cfg, &gp_ptr, &xcs](const auto& eph) {
+              using E = std::remove_const_t<
+                  typename std::decay_t<decltype(eph)>::element_type>;
+              std::shared_ptr<eom::GpAccess> accessor =
+                  std::make_shared<eom::GpAccessStd<E>>(cfg.getStartTime(),
+                                                        cfg.getStopTime(),
+                                                        *gp_ptr,
+                                                        xcs,
+                                                        eph);
+              return accessor;
+            }, eom::resolve_ephemeris(eph_ptr));
       }
     } catch (const std::out_of_range& oor) {
       using namespace std::string_literals;
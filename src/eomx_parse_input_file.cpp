@@ -18,6 +18,7 @@
 
 #include <astro_orbit_def.h>
 #include <astro_rel_orbit_def.h>
+#include <astro_dispersion_def.h>
 #include <astro_ephemeris_file.h>
 #include <axs_gp_access_def.h>
 
@@ -36,6 +37,7 @@ void eomx_parse_input_file(const std::string& fname,
                            eom_app::EomConfig& cfg,
                            std::vector<eom::OrbitDef>& orbit_defs,
                            std::vector<eom::RelOrbitDef>& rel_orbit_defs,
+                           std::vector<eom::DispersionDef>& dispersion_defs,
                            std::vector<eom::EphemerisFile>& eph_file_defs,
                            std::unordered_map<std::string,std::shared_ptr<
                                               eom::GroundPoint>>& ground_points,
@@ -97,6 +99,12 @@ void eomx_parse_input_file(const std::string& fname,
             } else if (make == "EcfEciRate") {
               cfg.setEcfEciRate(tokens);
               input_error = !cfg.isValid();
+            } else if (make == "EcfEciCache") {
+              cfg.setEcfEciCache(tokens);
+              input_error = !cfg.isValid();
+            } else if (make == "EphemerisCache") {
+              cfg.addEphemerisCache(tokens);
+              input_error = !cfg.isValid();
             } else if (make == "end") {
               input_error = false;
               ifs.seekg(0, std::ios::end);
@@ -163,6 +171,15 @@ void eomx_parse_input_file(const std::string& fname,
                 std::string xerror = ia.what();
                 other_error = "Invalid Relative Orbit definition: " + xerror;
               }
+            } else if (make == "Dispersion") {
+              try {
+                dispersion_defs.push_back(
+                    eom_app::parse_dispersion_def(tokens, cfg));
+                input_error = false;
+              } catch (const std::invalid_argument& ia) {
+                std::string xerror = ia.what();
+                other_error = "Invalid Dispersion definition: " + xerror;
+              }
             } else if (make == "EphemerisFile") {
               try {
                 eph_file_defs.push_back(eom_app::parse_eph_file_def(tokens));
@@ -277,4 +294,19 @@ void eomx_parse_input_file(const std::string& fname,
     }
   }
 
+    // Dispersions are also based on primary orbit definitions
+  for (const auto& dispersion : dispersion_defs) {
+    bool found {false};
+    for (const auto& orbit : orbit_defs) {
+      if (orbit.getOrbitName() == dispersion.getTemplateOrbitName()) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      throw eom_app::EomXException("eomx::Bad Dispersion Template Name: " +
+                                   dispersion.getTemplateOrbitName());
+    }
+  }
+
 }
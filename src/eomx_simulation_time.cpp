@@ -10,6 +10,7 @@
 
 #include <phy_const.h>
 #include <astro_orbit_def.h>
+#include <astro_propagator_config.h>
 #include <cal_julian_date.h>
 
 #include <eom_config.h>
@@ -34,13 +35,21 @@ eomx_simulation_time(const eom_app::EomConfig& cfg,
     if (maxJd < orbit.getEpoch()) {
       maxJd = orbit.getEpoch();
     }
-      // Backwards propagation for SP methods not currently supported
-    if (orbit.getPropagatorConfig().getPropagatorType() ==
-                                  eom::PropagatorType::sp) {
+      // Backwards propagation for SP methods is supported by the
+      // integrators listed below - RK4s (regularized) and the GENPL
+      // Gauss-Jackson variants propagate forward only
+    const eom::PropagatorConfig& pCfg = orbit.getPropagatorConfig();
+    if (pCfg.getPropagatorType() == eom::PropagatorType::sp  &&
+        pCfg.getPropagator() != eom::Propagator::rk4  &&
+        pCfg.getPropagator() != eom::Propagator::adams4  &&
+        pCfg.getPropagator() != eom::Propagator::adams  &&
+        pCfg.getPropagator() != eom::Propagator::gj8  &&
+        pCfg.getPropagator() != eom::Propagator::rkf78) {
       if (!(orbit.getEpoch() - cfg.getStartTime()  <  phy_const::epsdt_days)) {
         throw eom_app::EomXException(
             "eomx:: SP orbit eopch for  " + orbit.getOrbitName() +
-            " must occur on or before the simulation start time.");
+            " must occur on or before the simulation start time" +
+            " with the selected integrator.");
       }
     }
   }
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <eom_parse.h>
+
+#include <stdexcept>
+#include <string>
+#include <deque>
+
+#include <Eigen/Dense>
+
+#include <astro_dispersion_def.h>
+
+#include <eom_config.h>
+
+namespace eom_app {
+
+eom::DispersionDef parse_dispersion_def(std::deque<std::string>& tokens,
+                                        const EomConfig& cfg)
+{
+  using namespace std::string_literals;
+    // Need at least the name, template name, samples, seed, covariance
+    // type, and output filename
+  if (tokens.size() < 6) {
+     throw std::invalid_argument("eom_app::parse_dispersion_def() "s +
+         "Invalid number of tokens to parse_dispersion_def: "s +
+         std::to_string(tokens.size()));
+  }
+  auto name = tokens[0];
+  tokens.pop_front();
+  auto template_name = tokens[0];
+  tokens.pop_front();
+    // Parsed as signed so negative values are rejected rather than
+    // wrapping
+  long long samples {0LL};
+  long long seed {0LL};
+  try {
+    samples = std::stoll(tokens[0]);
+    tokens.pop_front();
+    seed = std::stoll(tokens[0]);
+    tokens.pop_front();
+  } catch (const std::invalid_argument& ia) {
+    throw std::invalid_argument("eom_app::parse_dispersion_def() "s +
+                                "Invalid number of samples or seed"s);
+  } catch (const std::out_of_range& oor) {
+    throw std::invalid_argument("eom_app::parse_dispersion_def() "s +
+                                "Number of samples or seed out of range"s);
+  }
+  if (samples <= 0LL  ||  seed < 0LL) {
+    throw std::invalid_argument("eom_app::parse_dispersion_def() "s +
+        "Number of samples must be positive, seed non-negative"s);
+  }
+  auto cov_type = tokens[0];
+  tokens.pop_front();
+
+    // Input units to DU and TU, position then velocity
+  Eigen::Matrix<double, 6, 1> io2dutu;
+  io2dutu.block<3, 1>(0, 0).setConstant(1.0/cfg.getIoPerDu());
+  io2dutu.block<3, 1>(3, 0).setConstant(cfg.getIoPerTu()/cfg.getIoPerDu());
+
+    // Out of range values reported as parsing errors
+  auto to_double = [](const std::string& token) {
+    try {
+      return std::stod(token);
+    } catch (const std::out_of_range& oor) {
+      throw std::invalid_argument("eom_app::parse_dispersion_def() "s +
+                                  "Covariance value out of range: "s + token);
+    }
+  };
+  Eigen::Matrix<double, 6, 6> cov;
+  if (cov_type == "Sigma"  &&  tokens.size() > 6) {
+      // Standard deviations, uncorrelated
+    cov.setZero();
+    for (int ii=0; ii<6; ++ii) {
+      double sigma {io2dutu(ii)*to_double(tokens[0])};
+      tokens.pop_front();
+      cov(ii, ii) = sigma*sigma;
+    }
+  } else if (cov_type == "Covariance"  &&  tokens.size() > 21) {
+      // Upper triangular, row by row
+    for (int ii=0; ii<6; ++ii) {
+      for (int jj=ii; jj<6; ++jj) {
+        cov(ii, jj) = io2dutu(ii)*io2dutu(jj)*to_double(tokens[0]);
+        tokens.pop_front();
+        cov(jj, ii) = cov(ii, jj);
+      }
+    }
+  } else {
+    throw std::invalid_argument("eom_app::parse_dispersion_def() "s +
+                                "Invalid covariance type: "s + cov_type);
+  }
+  auto file_name = tokens[0];
+  tokens.pop_front();
+
+  eom::DispersionDef dispersion {name, template_name,
+                                 static_cast<unsigned long>(samples),
+                                 static_cast<unsigned long>(seed),
+                                 cov, file_name};
+  return dispersion;
+}
+
+}
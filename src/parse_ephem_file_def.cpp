@@ -29,7 +29,12 @@ eom::EphemerisFile parse_eph_file_def(std::deque<std::string>& tokens)
   auto name = tokens[0];
   tokens.pop_front();
   auto model = tokens[0];
+  eom::EphFileFormat format {};
   if (model == "SP3c") {
+    format = eom::EphFileFormat::sp3c;
+    tokens.pop_front();
+  } else if (model == "EomBinary") {
+    format = eom::EphFileFormat::eom_binary;
     tokens.pop_front();
   } else {
      throw std::invalid_argument("eom_app::parse_eph_file_def() "s +
@@ -48,12 +53,19 @@ eom::EphemerisFile parse_eph_file_def(std::deque<std::string>& tokens)
                                  "Invalid ephemeris interpolation type: "s +
                                  interp);
   }
+    // Binary ephemeris stores Hermite polynomials only
+  if (format == eom::EphFileFormat::eom_binary  &&
+      interp_type != eom::EphInterpType::hermite) {
+     throw std::invalid_argument("eom_app::parse_eph_file_def() "s +
+                                 "EomBinary ephemeris requires Hermite "s +
+                                 "interpolation"s);
+  }
 
   auto file_name = tokens[0];
   tokens.pop_front();
   eom::EphemerisFile efd(name,
                          file_name,
-                         eom::EphFileFormat::sp3c,
+                         format,
                          interp_type);
   return efd;
 }
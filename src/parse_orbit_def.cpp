@@ -29,6 +29,8 @@ static void parse_moon_model(std::deque<std::string>&,
                              eom::PropagatorConfig&);
 static void parse_other_model(std::deque<std::string>&,
                               eom::PropagatorConfig&);
+static void parse_ephem_storage(std::deque<std::string>&,
+                                eom::PropagatorConfig&);
 
 namespace eom_app {
 
@@ -63,13 +65,18 @@ eom::OrbitDef parse_orbit_def(std::deque<std::string>& tokens,
       //   3. Moon gravity model
       //   4. Other gravity (planets)
       //   5. Integrator options
-    int sp_options {5};
+      //   6. ECF interpolation storage option
+      //   7. Compact storage option
+      //   8. Lazy propagation storage option
+      //   9. Ensemble propagation option
+    int sp_options {9};
     for (int ii=0; ii<sp_options; ++ii) {
       parse_gravity_model(tokens, propCfg);
       parse_sun_model(tokens, propCfg);
       parse_moon_model(tokens, propCfg);
       parse_other_model(tokens, propCfg);
       parse_propagator(tokens, propCfg);
+      parse_ephem_storage(tokens, propCfg);
       if (tokens.size() == 0) {
         break;
       }
@@ -146,7 +153,7 @@ eom::OrbitDef parse_orbit_def(std::deque<std::string>& tokens,
 static void parse_propagator(std::deque<std::string>& prop_toks,
                              eom::PropagatorConfig& pCfg)
 {
-    // "Propagator  Method Dur dt"
+    // "Propagator  Method Dur dt [Tolerance rel [abs]]"
   if (prop_toks.size() > 3  &&  prop_toks[0] == "Propagator") {
     prop_toks.pop_front();
     if (prop_toks[0] == "RK4") {
@@ -158,6 +165,15 @@ static void parse_propagator(std::deque<std::string>& prop_toks,
     } else if (prop_toks[0] == "Adams4") {
       prop_toks.pop_front();
       pCfg.setPropagator(eom::Propagator::adams4);
+    } else if (prop_toks[0] == "AdamsVSVO") {
+      prop_toks.pop_front();
+      pCfg.setPropagator(eom::Propagator::adams);
+    } else if (prop_toks[0] == "GJ8") {
+      prop_toks.pop_front();
+      pCfg.setPropagator(eom::Propagator::gj8);
+    } else if (prop_toks[0] == "RKF78") {
+      prop_toks.pop_front();
+      pCfg.setPropagator(eom::Propagator::rkf78);
 #ifdef GENPL
     } else if (prop_toks[0] == "GJ") {
       prop_toks.pop_front();
@@ -168,6 +184,28 @@ static void parse_propagator(std::deque<std::string>& prop_toks,
 #endif
     }
     pCfg.setStepSize(eom_app::parse_duration(prop_toks));
+      // Error tolerances for adaptive step size integrators, with
+      // the absolute tolerance defaulting to the relative
+    if (prop_toks.size() > 1  &&  prop_toks[0] == "Tolerance") {
+      prop_toks.pop_front();
+      double rel_tol {std::stod(prop_toks[0])};
+      prop_toks.pop_front();
+      double abs_tol {rel_tol};
+      if (prop_toks.size() > 0) {
+        try {
+          abs_tol = std::stod(prop_toks[0]);
+          prop_toks.pop_front();
+        } catch (const std::invalid_argument& ia) {
+          ;
+        }
+      }
+      pCfg.setTolerance(rel_tol, abs_tol);
+    }
+  }
+    // "Ensemble"
+  if (prop_toks.size() > 0  &&  prop_toks[0] == "Ensemble") {
+    prop_toks.pop_front();
+    pCfg.enableEnsemble();
   }
 }
 
@@ -265,3 +303,36 @@ static void parse_other_model(std::deque<std::string>& other_toks,
     pCfg.enableOtherGravityModels();
   }
 }
+
+
+static void parse_ephem_storage(std::deque<std::string>& storage_toks,
+                                eom::PropagatorConfig& pCfg)
+{
+    // "EcfInterpolation"
+  if (storage_toks.size() > 0  &&  storage_toks[0] == "EcfInterpolation") {
+    storage_toks.pop_front();
+    pCfg.enableEcfInterpolation();
+  }
+    // "CompactStorage"
+  if (storage_toks.size() > 0  &&  storage_toks[0] == "CompactStorage") {
+    storage_toks.pop_front();
+    pCfg.enableCompactStorage();
+  }
+    // "LazyPropagation Dur dt [MaxSegments n]" - a segment limit is
+    // rejected by pCfg for adaptive integrators
+  if (storage_toks.size() > 2  &&  storage_toks[0] == "LazyPropagation") {
+    storage_toks.pop_front();
+    eom::Duration seg = eom_app::parse_duration(storage_toks);
+    unsigned long max_segments {0UL};
+    if (storage_toks.size() > 1  &&  storage_toks[0] == "MaxSegments") {
+      storage_toks.pop_front();
+      try {
+        max_segments = std::stoul(storage_toks[0]);
+        storage_toks.pop_front();
+      } catch (const std::invalid_argument& ia) {
+        ;
+      }
+    }
+    pCfg.setLazyPropagation(seg, max_segments);
+  }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 Kurt Motekew
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <utl_mapped_file.h>
+
+#include <cstddef>
+#include <string>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#if defined(__unix__)  ||  defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define EOM_USE_MMAP
+#endif
+
+namespace eom {
+
+
+MappedFile::MappedFile(const std::string& fname)
+{
+#ifdef EOM_USE_MMAP
+  int fd {::open(fname.c_str(), O_RDONLY)};
+  if (fd < 0) {
+    throw std::runtime_error("MappedFile::MappedFile() Can't open " + fname);
+  }
+  struct stat sb;
+  if (::fstat(fd, &sb) != 0) {
+    ::close(fd);
+    throw std::runtime_error("MappedFile::MappedFile() Can't stat " + fname);
+  }
+  m_size = static_cast<std::size_t>(sb.st_size);
+    // Zero length mappings are not allowed - empty view
+  if (m_size > 0) {
+    void* addr {::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+    if (addr == MAP_FAILED) {
+      ::close(fd);
+      throw std::runtime_error("MappedFile::MappedFile() Can't map " + fname);
+    }
+    m_data = static_cast<const char*>(addr);
+    m_mapped = true;
+  }
+    // Mapping remains valid after the descriptor is closed
+  ::close(fd);
+#else
+  std::ifstream ifs(fname, std::ios::binary);
+  if (!ifs.is_open()) {
+    throw std::runtime_error("MappedFile::MappedFile() Can't open " + fname);
+  }
+  m_buffer.assign(std::istreambuf_iterator<char>(ifs),
+                  std::istreambuf_iterator<char>());
+  m_data = m_buffer.data();
+  m_size = m_buffer.size();
+#endif
+}
+
+
+MappedFile::~MappedFile()
+{
+#ifdef EOM_USE_MMAP
+  if (m_mapped) {
+    ::munmap(const_cast<char*>(m_data), m_size);
+  }
+#endif
+}
+
+
+}